@@ -0,0 +1,296 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace detail {
+    inline int PopCount(uint64_t word) noexcept {
+#if defined(__GNUC__)
+        return __builtin_popcountll(word);
+#else
+        int count = 0;
+        for (; word != 0; word &= word - 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    inline size_t CountBitsGeneric(const uint64_t *words, size_t n) noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < n; ++i) {
+            count += PopCount(words[i]);
+        }
+        return count;
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(__POPCNT__)
+    // Без -mpopcnt __builtin_popcountll вызывает библиотечную функцию, поэтому цикл
+    // собирается отдельно с инструкцией popcnt и выбирается, если процессор её поддерживает
+    __attribute__((target("popcnt"))) inline size_t CountBitsPopcnt(const uint64_t *words, size_t n) noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < n; ++i) {
+            count += __builtin_popcountll(words[i]);
+        }
+        return count;
+    }
+
+    inline size_t CountBits(const uint64_t *words, size_t n) noexcept {
+        static const bool has_popcnt = __builtin_cpu_supports("popcnt");
+        return has_popcnt ? CountBitsPopcnt(words, n) : CountBitsGeneric(words, n);
+    }
+#else
+    inline size_t CountBits(const uint64_t *words, size_t n) noexcept {
+        return CountBitsGeneric(words, n);
+    }
+#endif
+
+    // Номер младшего установленного бита; word != 0
+    inline size_t CountTrailingZeros(uint64_t word) noexcept {
+        assert(word != 0);
+#if defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#else
+        size_t count = 0;
+        for (; (word & 1) == 0; word >>= 1) {
+            ++count;
+        }
+        return count;
+#endif
+    }
+}  // namespace detail
+
+// Вектор битов, упакованных по 64 в слово RawMemory<uint64_t>: в 8 раз компактнее Vector<bool>.
+// Подсчёт, поиск и побитовые операции обрабатывают целое слово за шаг (popcnt, tzcnt).
+// Биты последнего слова за пределами Size() всегда равны нулю
+class BitVector {
+    static constexpr size_t kWordBits = 64;
+
+public:
+    // Возвращается FindFirst и FindNext, когда установленных битов больше нет
+    static constexpr size_t kNpos = static_cast<size_t>(-1);
+
+    BitVector() = default;
+
+    explicit BitVector(size_t size, bool value = false) {
+        Resize(size, value);
+    }
+
+    BitVector(const BitVector &other)
+            : words_(WordCount(other.size_)), size_(other.size_) {
+        detail::UninitializedCopyN(other.words_.GetAddress(), WordCount(size_), words_.GetAddress());
+    }
+
+    BitVector(BitVector &&other) noexcept
+            : words_(std::move(other.words_)), size_(std::exchange(other.size_, 0)) {
+    }
+
+    BitVector &operator=(const BitVector &rhs) {
+        if (this != &rhs) {
+            if (WordCount(rhs.size_) > words_.Capacity()) {
+                BitVector rhs_copy(rhs);
+                Swap(rhs_copy);
+            } else {
+                detail::UninitializedCopyN(rhs.words_.GetAddress(), WordCount(rhs.size_), words_.GetAddress());
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    BitVector &operator=(BitVector &&rhs) noexcept {
+        if (this != &rhs) {
+            words_ = std::move(rhs.words_);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    void Swap(BitVector &other) noexcept {
+        words_.Swap(other.words_);
+        std::swap(size_, other.size_);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return words_.Capacity() * kWordBits;
+    }
+
+    void Reserve(size_t new_capacity) {
+        ReserveWords(WordCount(new_capacity));
+    }
+
+    // Новые биты получают значение value
+    void Resize(size_t n, bool value = false) {
+        if (n > size_) {
+            ReserveWords(WordCount(n));
+            const size_t used = WordCount(size_);
+            if (value) {
+                // Хвост последнего слова и новые слова заполняются единицами, лишнее срезает ClearTail
+                if (size_ % kWordBits != 0) {
+                    words_[used - 1] |= ~uint64_t{0} << (size_ % kWordBits);
+                }
+                std::fill(words_ + used, words_ + WordCount(n), ~uint64_t{0});
+            } else {
+                std::fill(words_ + used, words_ + WordCount(n), uint64_t{0});
+            }
+        }
+        size_ = n;
+        ClearTail();
+    }
+
+    void PushBack(bool value) {
+        if (size_ % kWordBits == 0) {
+            const size_t words = size_ / kWordBits;
+            if (words == words_.Capacity()) {
+                ReserveWords(DoublingGrowth::NextCapacity(words_.Capacity(), words + 1, sizeof(uint64_t)));
+            }
+            words_[words] = 0;
+        }
+        ++size_;
+        Set(size_ - 1, value);
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            Reset(size_ - 1);
+            --size_;
+        }
+    }
+
+    bool Test(size_t index) const noexcept {
+        assert(index < size_);
+        return (words_[index / kWordBits] >> (index % kWordBits)) & 1;
+    }
+
+    bool operator[](size_t index) const noexcept {
+        return Test(index);
+    }
+
+    void Set(size_t index, bool value = true) noexcept {
+        assert(index < size_);
+        const uint64_t mask = uint64_t{1} << (index % kWordBits);
+        uint64_t &word = words_[index / kWordBits];
+        word = value ? word | mask : word & ~mask;
+    }
+
+    void Reset(size_t index) noexcept {
+        Set(index, false);
+    }
+
+    void Flip(size_t index) noexcept {
+        assert(index < size_);
+        words_[index / kWordBits] ^= uint64_t{1} << (index % kWordBits);
+    }
+
+    // Число установленных битов
+    size_t Count() const noexcept {
+        return detail::CountBits(words_.GetAddress(), WordCount(size_));
+    }
+
+    size_t FindFirst() const noexcept {
+        return FindFrom(0);
+    }
+
+    // Первый установленный бит после pos
+    size_t FindNext(size_t pos) const noexcept {
+        return pos + 1 < size_ ? FindFrom(pos + 1) : kNpos;
+    }
+
+    // Побитовые операции требуют векторов одинакового размера
+    BitVector &operator&=(const BitVector &rhs) noexcept {
+        return Combine(rhs, [](uint64_t lhs, uint64_t rhs) {
+            return lhs & rhs;
+        });
+    }
+
+    BitVector &operator|=(const BitVector &rhs) noexcept {
+        return Combine(rhs, [](uint64_t lhs, uint64_t rhs) {
+            return lhs | rhs;
+        });
+    }
+
+    BitVector &operator^=(const BitVector &rhs) noexcept {
+        return Combine(rhs, [](uint64_t lhs, uint64_t rhs) {
+            return lhs ^ rhs;
+        });
+    }
+
+    friend BitVector operator&(BitVector lhs, const BitVector &rhs) noexcept {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    friend BitVector operator|(BitVector lhs, const BitVector &rhs) noexcept {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    friend BitVector operator^(BitVector lhs, const BitVector &rhs) noexcept {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+    friend bool operator==(const BitVector &lhs, const BitVector &rhs) noexcept {
+        return lhs.size_ == rhs.size_
+               && std::equal(lhs.words_.GetAddress(), lhs.words_ + WordCount(lhs.size_), rhs.words_.GetAddress());
+    }
+
+    friend bool operator!=(const BitVector &lhs, const BitVector &rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr size_t WordCount(size_t bits) noexcept {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+
+    void ReserveWords(size_t new_words) {
+        if (new_words > words_.Capacity()) {
+            RawMemory<uint64_t> new_words_memory(new_words);
+            detail::RelocateN(words_.GetAddress(), WordCount(size_), new_words_memory.GetAddress());
+            words_.Swap(new_words_memory);
+        }
+    }
+
+    // Обнуляет биты последнего слова за пределами size_
+    void ClearTail() noexcept {
+        if (size_ % kWordBits != 0) {
+            words_[size_ / kWordBits] &= (uint64_t{1} << (size_ % kWordBits)) - 1;
+        }
+    }
+
+    size_t FindFrom(size_t pos) const noexcept {
+        if (pos >= size_) {
+            return kNpos;
+        }
+        size_t index = pos / kWordBits;
+        uint64_t word = words_[index] & (~uint64_t{0} << (pos % kWordBits));
+        for (const size_t words = WordCount(size_); word == 0; word = words_[index]) {
+            if (++index == words) {
+                return kNpos;
+            }
+        }
+        return index * kWordBits + detail::CountTrailingZeros(word);
+    }
+
+    template<typename Op>
+    BitVector &Combine(const BitVector &rhs, Op op) noexcept {
+        assert(size_ == rhs.size_);
+        for (size_t i = 0, words = WordCount(size_); i < words; ++i) {
+            words_[i] = op(words_[i], rhs.words_[i]);
+        }
+        return *this;
+    }
+
+    RawMemory<uint64_t> words_;
+    size_t size_ = 0;
+};
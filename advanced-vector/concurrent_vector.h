@@ -0,0 +1,146 @@
+#pragma once
+
+#include "vector.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Вектор, в который несколько потоков добавляют элементы без блокировок. Элементы хранятся
+// в сегментах RawMemory, размер которых удваивается: сегмент k вмещает kFirstSegment << k элементов.
+// Сегменты не перевыделяются, поэтому элементы никогда не перемещаются и ссылки на них остаются
+// действительными до уничтожения вектора.
+//
+// EmplaceBack захватывает индекс атомарным fetch_add, конструирует элемент и публикует его.
+// Читать элемент из другого потока можно после того, как IsPublished(index) вернул true
+// (или после иной синхронизации с добавившим его потоком). Если конструктор T или выделение
+// сегмента бросили исключение, захваченный индекс остаётся неопубликованным навсегда
+template<typename T>
+class ConcurrentVector {
+    static constexpr size_t kFirstSegmentShift = 5;
+    static constexpr size_t kFirstSegment = size_t{1} << kFirstSegmentShift;
+    static constexpr size_t kMaxSegments = sizeof(size_t) * 8 - kFirstSegmentShift;
+
+    // Элементы сегмента и флаги их публикации
+    struct Segment {
+        explicit Segment(size_t capacity)
+                : elements(capacity), published(std::make_unique<std::atomic<bool>[]>(capacity)) {
+        }
+
+        RawMemory<T> elements;
+        std::unique_ptr<std::atomic<bool>[]> published;
+    };
+
+public:
+    ConcurrentVector() = default;
+
+    ConcurrentVector(const ConcurrentVector &) = delete;
+    ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+
+    // Уничтожение не должно пересекаться с добавлением и чтением из других потоков
+    ~ConcurrentVector() {
+        for (size_t k = 0; k < kMaxSegments; ++k) {
+            Segment *segment = segments_[k].load(std::memory_order_acquire);
+            if (segment == nullptr) {
+                continue;
+            }
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < segment->elements.Capacity(); ++i) {
+                    if (segment->published[i].load(std::memory_order_relaxed)) {
+                        std::destroy_at(segment->elements + i);
+                    }
+                }
+            }
+            delete segment;
+        }
+    }
+
+    // Конструирует элемент в следующей свободной ячейке и возвращает его индекс
+    template<typename... Args>
+    size_t EmplaceBack(Args &&... args) {
+        const size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+        const auto [k, offset] = Locate(index);
+        Segment &segment = GetOrCreateSegment(k);
+        // Поток, занявший середину сегмента, создаёт следующий, пока до него не дошли остальные:
+        // иначе все потоки, первыми попавшие в новый сегмент, выделяли бы и обнуляли его копии
+        if (offset == segment.elements.Capacity() / 2 && k + 1 < kMaxSegments) {
+            GetOrCreateSegment(k + 1);
+        }
+        new(segment.elements + offset) T(std::forward<Args>(args)...);
+        segment.published[offset].store(true, std::memory_order_release);
+        return index;
+    }
+
+    template<typename E>
+    size_t PushBack(E &&elem) {
+        return EmplaceBack(std::forward<E>(elem));
+    }
+
+    // Заранее выделяет сегменты под n элементов, чтобы EmplaceBack не обращался к аллокатору
+    void Reserve(size_t n) {
+        if (n == 0) {
+            return;
+        }
+        const size_t last_segment = Locate(n - 1).first;
+        for (size_t k = 0; k <= last_segment; ++k) {
+            GetOrCreateSegment(k);
+        }
+    }
+
+    // Число захваченных индексов; часть элементов может быть ещё не опубликована
+    size_t Size() const noexcept {
+        return size_.load(std::memory_order_acquire);
+    }
+
+    // Элемент сконструирован, и его значение видно вызывающему потоку
+    bool IsPublished(size_t index) const noexcept {
+        if (index >= Size()) {
+            return false;
+        }
+        const auto [k, offset] = Locate(index);
+        const Segment *segment = segments_[k].load(std::memory_order_acquire);
+        return segment != nullptr && segment->published[offset].load(std::memory_order_acquire);
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<ConcurrentVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(IsPublished(index));
+        const auto [k, offset] = Locate(index);
+        return segments_[k].load(std::memory_order_acquire)->elements[offset];
+    }
+
+private:
+    // Номер сегмента и смещение в нём: индекс index + kFirstSegment лежит в сегменте,
+    // номер которого на kFirstSegmentShift меньше номера его старшего бита
+    static std::pair<size_t, size_t> Locate(size_t index) noexcept {
+        const size_t shifted = index + kFirstSegment;
+        const size_t high_bit = detail::HighestBit(shifted);
+        return {high_bit - kFirstSegmentShift, shifted - (size_t{1} << high_bit)};
+    }
+
+    // Сегмент создаёт первый обратившийся к нему поток; проигравший гонку удаляет свою копию.
+    // Гонка случается редко: EmplaceBack создаёт следующий сегмент заранее
+    Segment &GetOrCreateSegment(size_t k) {
+        assert(k < kMaxSegments);
+        Segment *segment = segments_[k].load(std::memory_order_acquire);
+        if (segment != nullptr) {
+            return *segment;
+        }
+        auto created = std::make_unique<Segment>(kFirstSegment << k);
+        if (segments_[k].compare_exchange_strong(segment, created.get(), std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+            return *created.release();
+        }
+        return *segment;
+    }
+
+    std::array<std::atomic<Segment *>, kMaxSegments> segments_{};
+    std::atomic<size_t> size_{0};
+};
@@ -0,0 +1,418 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace detail {
+    // Индекс первого ключа, не меньшего key, среди n упорядоченных ключей key_at(0..n-1).
+    // Диапазон каждый раз делится пополам без ветвления по результату сравнения
+    // (компилятор выбирает половину через cmov), поэтому промахи предсказателя переходов не копятся
+    template<typename KeyAt, typename Key, typename Compare>
+    size_t BranchlessLowerBound(size_t n, KeyAt key_at, const Key &key, const Compare &comp) {
+        if (n == 0) {
+            return 0;
+        }
+        size_t base = 0;
+        while (n > 1) {
+            const size_t half = n / 2;
+            base = comp(key_at(base + half), key) ? base + half : base;
+            n -= half;
+        }
+        return base + static_cast<size_t>(comp(key_at(base), key));
+    }
+
+    // Пары ключ-значение в одном векторе: ключ и значение рядом в памяти
+    template<typename K, typename V>
+    class FlatPairStorage {
+    public:
+        size_t Size() const noexcept {
+            return items_.Size();
+        }
+
+        void Reserve(size_t n) {
+            items_.Reserve(n);
+        }
+
+        const K &Key(size_t index) const noexcept {
+            return items_[index].first;
+        }
+
+        K &Key(size_t index) noexcept {
+            return items_[index].first;
+        }
+
+        V &Value(size_t index) noexcept {
+            return items_[index].second;
+        }
+
+        const V &Value(size_t index) const noexcept {
+            return items_[index].second;
+        }
+
+        template<typename KeyArg, typename... Args>
+        void Emplace(size_t index, KeyArg &&key, Args &&... args) {
+            items_.Emplace(items_.cbegin() + index, std::piecewise_construct,
+                           std::forward_as_tuple(std::forward<KeyArg>(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        void Erase(size_t index) {
+            items_.Erase(items_.cbegin() + index);
+        }
+
+        void Swap(FlatPairStorage &other) noexcept {
+            items_.Swap(other.items_);
+        }
+
+    private:
+        Vector<std::pair<K, V>> items_;
+    };
+
+    // Ключи и значения в отдельных векторах: поиск читает только плотный массив ключей
+    template<typename K, typename V>
+    class FlatSplitStorage {
+    public:
+        size_t Size() const noexcept {
+            return keys_.Size();
+        }
+
+        void Reserve(size_t n) {
+            keys_.Reserve(n);
+            values_.Reserve(n);
+        }
+
+        const K &Key(size_t index) const noexcept {
+            return keys_[index];
+        }
+
+        K &Key(size_t index) noexcept {
+            return keys_[index];
+        }
+
+        V &Value(size_t index) noexcept {
+            return values_[index];
+        }
+
+        const V &Value(size_t index) const noexcept {
+            return values_[index];
+        }
+
+        // Если значение создать не удалось, вставленный ключ удаляется
+        template<typename KeyArg, typename... Args>
+        void Emplace(size_t index, KeyArg &&key, Args &&... args) {
+            keys_.Emplace(keys_.cbegin() + index, std::forward<KeyArg>(key));
+            try {
+                values_.Emplace(values_.cbegin() + index, std::forward<Args>(args)...);
+            } catch (...) {
+                keys_.Erase(keys_.cbegin() + index);
+                throw;
+            }
+        }
+
+        // Если перемещающее присваивание при сдвиге хвоста бросило исключение, содержимое векторов
+        // не определено, и хранилище очищается, чтобы ключи и значения не разошлись
+        void Erase(size_t index) {
+            try {
+                values_.Erase(values_.cbegin() + index);
+                keys_.Erase(keys_.cbegin() + index);
+            } catch (...) {
+                keys_.Clear();
+                values_.Clear();
+                throw;
+            }
+        }
+
+        void Swap(FlatSplitStorage &other) noexcept {
+            keys_.Swap(other.keys_);
+            values_.Swap(other.values_);
+        }
+
+    private:
+        Vector<K> keys_;
+        Vector<V> values_;
+    };
+}  // namespace detail
+
+// Упорядоченное множество в отсортированном Vector: поиск двоичный по непрерывной памяти,
+// вставка и удаление одного ключа стоят O(n), а пакет ключей добавляется через InsertSorted
+// одной сортировкой и одним слиянием
+template<typename K, typename Compare = std::less<K>>
+class FlatSet {
+public:
+    using const_iterator = const K *;
+
+    FlatSet() = default;
+
+    explicit FlatSet(const Compare &comp)
+            : comp_(comp) {
+    }
+
+    size_t Size() const noexcept {
+        return keys_.Size();
+    }
+
+    bool IsEmpty() const noexcept {
+        return keys_.Size() == 0;
+    }
+
+    void Reserve(size_t n) {
+        keys_.Reserve(n);
+    }
+
+    const_iterator LowerBound(const K &key) const {
+        return begin() + LowerBoundIndex(key);
+    }
+
+    const_iterator Find(const K &key) const {
+        const const_iterator it = LowerBound(key);
+        return it != end() && !comp_(key, *it) ? it : end();
+    }
+
+    bool Contains(const K &key) const {
+        return Find(key) != end();
+    }
+
+    // Возвращает позицию ключа и признак того, что он добавлен
+    template<typename Arg>
+    std::pair<const_iterator, bool> Insert(Arg &&key) {
+        const size_t index = LowerBoundIndex(key);
+        if (index != Size() && !comp_(key, keys_[index])) {
+            return {begin() + index, false};
+        }
+        keys_.Emplace(keys_.cbegin() + index, std::forward<Arg>(key));
+        return {begin() + index, true};
+    }
+
+    // Добавляет ключи диапазона: они дописываются в отдельный вектор, сортируются и сливаются
+    // с имеющимися за один проход, вместо O(n) сдвига на каждый ключ. Дубликаты отбрасываются
+    template<typename InputIt>
+    void InsertSorted(InputIt first, InputIt last) {
+        Vector<K> added;
+        added.AppendRange(first, last);
+        std::sort(added.begin(), added.end(), comp_);
+
+        // Сначала только сравнения: порядок слияния записывается в order (номер в keys_ или
+        // keys_.Size() + номер в added), затем ключи переносятся без вызовов comp_. Имеющиеся ключи
+        // перемещаются, если это не бросает исключений, иначе копируются, поэтому при исключении
+        // множество остаётся прежним (кроме ключей, которые можно только перемещать с исключениями)
+        const size_t size = keys_.Size();
+        Vector<size_t> order;
+        order.Reserve(size + added.Size());
+        const K *taken = nullptr;
+        for (size_t i = 0, j = 0; i < size || j < added.Size();) {
+            const bool take_lhs = j == added.Size() || (i < size && !comp_(added[j], keys_[i]));
+            const K &key = take_lhs ? keys_[i] : added[j];
+            if (taken == nullptr || comp_(*taken, key)) {
+                order.PushBack(take_lhs ? i : size + j);
+                taken = &key;
+            }
+            take_lhs ? ++i : ++j;
+        }
+
+        Vector<K> merged;
+        merged.Reserve(order.Size());
+        for (const size_t index: order) {
+            if (index < size) {
+                merged.PushBack(std::move_if_noexcept(keys_[index]));
+            } else {
+                merged.PushBack(std::move(added[index - size]));
+            }
+        }
+        keys_.Swap(merged);
+    }
+
+    size_t Erase(const K &key) {
+        const const_iterator it = Find(key);
+        if (it == end()) {
+            return 0;
+        }
+        keys_.Erase(it);
+        return 1;
+    }
+
+    const_iterator begin() const noexcept {
+        return keys_.begin();
+    }
+
+    const_iterator end() const noexcept {
+        return keys_.end();
+    }
+
+private:
+    size_t LowerBoundIndex(const K &key) const {
+        return detail::BranchlessLowerBound(keys_.Size(), [this](size_t index) -> const K & {
+            return keys_[index];
+        }, key, comp_);
+    }
+
+    Vector<K> keys_;
+    Compare comp_;
+};
+
+// Упорядоченное отображение в отсортированных векторах. При SplitStorage ключи и значения
+// хранятся в отдельных векторах, и поиск читает только плотный массив ключей; иначе пары
+// ключ-значение лежат вместе. Элементы перебираются по индексу через KeyAt и ValueAt
+template<typename K, typename V, typename Compare = std::less<K>, bool SplitStorage = false>
+class FlatMap {
+    using Storage = std::conditional_t<SplitStorage, detail::FlatSplitStorage<K, V>, detail::FlatPairStorage<K, V>>;
+
+    // При слиянии значения забираются из старого хранилища через std::move_if_noexcept: копируются,
+    // только если перемещение может бросить исключение, а копирование возможно. Ключ перемещается,
+    // когда ни перемещение ключа, ни перенос значения не бросают (иначе ключ копируется, и при
+    // исключении отображение остаётся прежним), а также когда ключ нельзя скопировать
+    static constexpr bool kMoveKeysOnMerge = !std::is_copy_constructible_v<K>
+                                             || (std::is_nothrow_move_constructible_v<K>
+                                                 && std::is_nothrow_move_constructible_v<V>);
+
+public:
+    FlatMap() = default;
+
+    explicit FlatMap(const Compare &comp)
+            : comp_(comp) {
+    }
+
+    size_t Size() const noexcept {
+        return storage_.Size();
+    }
+
+    bool IsEmpty() const noexcept {
+        return storage_.Size() == 0;
+    }
+
+    void Reserve(size_t n) {
+        storage_.Reserve(n);
+    }
+
+    const K &KeyAt(size_t index) const noexcept {
+        assert(index < Size());
+        return storage_.Key(index);
+    }
+
+    V &ValueAt(size_t index) noexcept {
+        assert(index < Size());
+        return storage_.Value(index);
+    }
+
+    const V &ValueAt(size_t index) const noexcept {
+        assert(index < Size());
+        return storage_.Value(index);
+    }
+
+    // Значение по ключу или nullptr, если ключа нет
+    V *Find(const K &key) {
+        const size_t index = FindIndex(key);
+        return index != Size() ? &storage_.Value(index) : nullptr;
+    }
+
+    const V *Find(const K &key) const {
+        return const_cast<FlatMap &>(*this).Find(key);
+    }
+
+    bool Contains(const K &key) const {
+        return FindIndex(key) != Size();
+    }
+
+    // Индекс ключа или Size(), если ключа нет
+    size_t FindIndex(const K &key) const {
+        const size_t index = LowerBoundIndex(key);
+        return index != Size() && !comp_(key, storage_.Key(index)) ? index : Size();
+    }
+
+    // Добавляет значение, если ключа ещё нет; возвращает индекс ключа и признак вставки
+    template<typename KeyArg, typename... Args>
+    std::pair<size_t, bool> TryEmplace(KeyArg &&key, Args &&... args) {
+        const size_t index = LowerBoundIndex(key);
+        if (index != Size() && !comp_(key, storage_.Key(index))) {
+            return {index, false};
+        }
+        storage_.Emplace(index, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+        return {index, true};
+    }
+
+    template<typename KeyArg, typename Arg>
+    std::pair<size_t, bool> InsertOrAssign(KeyArg &&key, Arg &&value) {
+        const auto [index, inserted] = TryEmplace(std::forward<KeyArg>(key), std::forward<Arg>(value));
+        if (!inserted) {
+            storage_.Value(index) = std::forward<Arg>(value);
+        }
+        return {index, inserted};
+    }
+
+    V &operator[](const K &key) {
+        return storage_.Value(TryEmplace(key).first);
+    }
+
+    // Добавляет пары ключ-значение диапазона одной сортировкой и одним слиянием.
+    // Имеющиеся ключи сохраняют свои значения; из повторов внутри диапазона берётся первый
+    template<typename InputIt>
+    void InsertSorted(InputIt first, InputIt last) {
+        Vector<std::pair<K, V>> added;
+        added.AppendRange(first, last);
+        std::stable_sort(added.begin(), added.end(), [this](const auto &lhs, const auto &rhs) {
+            return comp_(lhs.first, rhs.first);
+        });
+
+        // Как и в FlatSet::InsertSorted, сравнения выполняются до переноса элементов, и исключение
+        // из comp_ не оставляет в хранилище перемещённых ключей
+        const size_t size = Size();
+        Vector<size_t> order;
+        order.Reserve(size + added.Size());
+        size_t i = 0;
+        size_t j = 0;
+        while (i < size || j < added.Size()) {
+            if (j == added.Size() || (i < size && !comp_(added[j].first, storage_.Key(i)))) {
+                while (j < added.Size() && !comp_(storage_.Key(i), added[j].first)) {
+                    ++j;
+                }
+                order.PushBack(i++);
+            } else {
+                const K &key = added[j].first;
+                order.PushBack(size + j++);
+                while (j < added.Size() && !comp_(key, added[j].first)) {
+                    ++j;
+                }
+            }
+        }
+
+        Storage merged;
+        merged.Reserve(order.Size());
+        for (const size_t index: order) {
+            if (index >= size) {
+                merged.Emplace(merged.Size(), std::move_if_noexcept(added[index - size].first),
+                               std::move_if_noexcept(added[index - size].second));
+            } else if constexpr (kMoveKeysOnMerge) {
+                merged.Emplace(merged.Size(), std::move(storage_.Key(index)),
+                               std::move_if_noexcept(storage_.Value(index)));
+            } else {
+                merged.Emplace(merged.Size(), std::as_const(storage_.Key(index)),
+                               std::move_if_noexcept(storage_.Value(index)));
+            }
+        }
+        storage_.Swap(merged);
+    }
+
+    size_t Erase(const K &key) {
+        const size_t index = FindIndex(key);
+        if (index == Size()) {
+            return 0;
+        }
+        storage_.Erase(index);
+        return 1;
+    }
+
+private:
+    size_t LowerBoundIndex(const K &key) const {
+        return detail::BranchlessLowerBound(Size(), [this](size_t index) -> const K & {
+            return storage_.Key(index);
+        }, key, comp_);
+    }
+
+    Storage storage_;
+    Compare comp_;
+};
@@ -0,0 +1,380 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Буфер с подвижным промежутком (gap buffer) на RawMemory: элементы лежат в начале и в конце блока,
+// а свободные ячейки образуют промежуток между ними. Вставка и удаление сначала переносят промежуток
+// к позиции, перемещая лишь элементы между старой и новой позицией, поэтому серия правок рядом
+// с одним местом стоит амортизированно O(1) вместо сдвига всего хвоста, как в Vector::Insert.
+// Итератор произвольного доступа пропускает промежуток; Compact() делает элементы непрерывными
+template<typename T>
+class GapBuffer {
+    template<bool IsConst>
+    class Iterator {
+        using Owner = std::conditional_t<IsConst, const GapBuffer, GapBuffer>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        Iterator() = default;
+
+        Iterator(Owner *owner, size_t index) noexcept
+                : owner_(owner), index_(index) {
+        }
+
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst> &other) noexcept
+                : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        Iterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        Iterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator old = *this;
+            --index_;
+            return old;
+        }
+
+        Iterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator<=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+        size_t Index() const noexcept {
+            return index_;
+        }
+
+    private:
+        friend class Iterator<!IsConst>;
+
+        Owner *owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    GapBuffer() = default;
+
+    GapBuffer(const GapBuffer &other)
+            : data_(other.Size()) {
+        detail::UninitializedCopyN(other.data_.GetAddress(), other.gap_begin_, data_.GetAddress());
+        try {
+            detail::UninitializedCopyN(other.data_ + other.gap_end_, other.SuffixSize(), data_ + other.gap_begin_);
+        } catch (...) {
+            detail::DestroyN(data_.GetAddress(), other.gap_begin_);
+            throw;
+        }
+        gap_begin_ = gap_end_ = other.Size();
+    }
+
+    GapBuffer(GapBuffer &&other) noexcept
+            : data_(std::move(other.data_)),
+              gap_begin_(std::exchange(other.gap_begin_, 0)),
+              gap_end_(std::exchange(other.gap_end_, 0)) {
+    }
+
+    GapBuffer &operator=(const GapBuffer &rhs) {
+        if (this != &rhs) {
+            GapBuffer rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    GapBuffer &operator=(GapBuffer &&rhs) noexcept {
+        if (this != &rhs) {
+            GapBuffer rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    void Swap(GapBuffer &other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+    }
+
+    ~GapBuffer() {
+        detail::DestroyN(data_.GetAddress(), gap_begin_);
+        detail::DestroyN(data_ + gap_end_, SuffixSize());
+    }
+
+    // Элементы переносятся в новый блок, промежуток оказывается в конце
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > data_.Capacity()) {
+            const size_t size = Size();
+            MoveGap(size);
+            RawMemory<T> new_data(new_capacity);
+            detail::RelocateN(data_.GetAddress(), size, new_data.GetAddress());
+            data_.Swap(new_data);
+            gap_end_ = new_capacity;
+        }
+    }
+
+    size_t Size() const noexcept {
+        return data_.Capacity() - (gap_end_ - gap_begin_);
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    // Позиция промежутка: индекс, перед которым вставка не переносит элементы
+    size_t Cursor() const noexcept {
+        return gap_begin_;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<GapBuffer &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < Size());
+        return data_[index < gap_begin_ ? index : index + (gap_end_ - gap_begin_)];
+    }
+
+    template<typename E>
+    void PushBack(E &&elem) {
+        EmplaceBack(std::forward<E>(elem));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        return *Emplace(cend(), std::forward<Args>(args)...);
+    }
+
+    void PopBack() {
+        Erase(cend() - 1);
+    }
+
+    // Переносит промежуток к pos и создаёт элемент в его первой ячейке
+    template<typename... Args>
+    iterator Emplace(const_iterator pos, Args &&... args) {
+        assert(pos >= cbegin() && pos <= cend());
+        const size_t index = pos.Index();
+        if constexpr ((is_self_contained_v<std::decay_t<Args>> && ...)) {
+            // Проверяется весь блок: элементы лежат по обе стороны промежутка
+            if (!detail::AliasesRange(data_.GetAddress(), data_.GetAddress() + data_.Capacity(), args...)) {
+                return EmplaceAt(index, std::forward<Args>(args)...);
+            }
+        }
+        // Аргумент может указывать на элемент, который переедет при переносе промежутка
+        T tmp(std::forward<Args>(args)...);
+        return EmplaceAt(index, std::move(tmp));
+    }
+
+    template<typename Arg>
+    iterator Insert(const_iterator pos, Arg &&arg) {
+        return Emplace(pos, std::forward<Arg>(arg));
+    }
+
+    iterator Erase(const_iterator pos) {
+        assert(pos >= cbegin() && pos < cend());
+        return Erase(pos, pos + 1);
+    }
+
+    // Промежуток переносится к last и поглощает удаляемые элементы
+    iterator Erase(const_iterator first, const_iterator last) {
+        assert(first >= cbegin() && first <= last && last <= cend());
+        MoveGap(last.Index());
+        detail::DestroyN(data_ + first.Index(), last - first);
+        gap_begin_ = first.Index();
+        return begin() + first.Index();
+    }
+
+    // Переносит промежуток в конец и возвращает указатель на непрерывные элементы
+    T *Compact() {
+        MoveGap(Size());
+        return data_.GetAddress();
+    }
+
+    iterator begin() noexcept {
+        return {this, 0};
+    }
+
+    iterator end() noexcept {
+        return {this, Size()};
+    }
+
+    const_iterator begin() const noexcept {
+        return {this, 0};
+    }
+
+    const_iterator end() const noexcept {
+        return {this, Size()};
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    size_t SuffixSize() const noexcept {
+        return data_.Capacity() - gap_end_;
+    }
+
+    template<typename... Args>
+    iterator EmplaceAt(size_t index, Args &&... args) {
+        if (gap_begin_ == gap_end_) {
+            // Промежуток пуст, значит элементы непрерывны: новый блок получает промежуток сразу у index
+            const size_t size = Size();
+            RawMemory<T> new_data(DoublingGrowth::NextCapacity(size, size + 1, sizeof(T)));
+            const size_t gap = new_data.Capacity() - size;
+            new(new_data + index) T(std::forward<Args>(args)...);
+            try {
+                detail::RelocateWithGap(data_.GetAddress(), size, index, gap, new_data.GetAddress());
+            } catch (...) {
+                std::destroy_at(new_data + index);
+                throw;
+            }
+            data_.Swap(new_data);
+            gap_begin_ = index + 1;
+            gap_end_ = index + gap;
+        } else {
+            MoveGap(index);
+            new(data_ + gap_begin_) T(std::forward<Args>(args)...);
+            ++gap_begin_;
+        }
+        return begin() + index;
+    }
+
+    // Переносит промежуток так, чтобы он начинался с индекса index. Элементы переносятся
+    // по одному, и после каждого шага буфер согласован: при исключении содержимое не меняется,
+    // а промежуток остаётся на промежуточной позиции
+    void MoveGap(size_t index) {
+        assert(index <= Size());
+        if (index < gap_begin_) {
+            const size_t count = gap_begin_ - index;
+            if constexpr (is_trivially_relocatable_v<T>) {
+                std::memmove(static_cast<void *>(data_ + gap_end_ - count), static_cast<const void *>(data_ + index),
+                             count * sizeof(T));
+                gap_begin_ -= count;
+                gap_end_ -= count;
+            } else {
+                while (gap_begin_ > index) {
+                    RelocateOne(data_ + gap_begin_ - 1, data_ + gap_end_ - 1);
+                    --gap_begin_;
+                    --gap_end_;
+                }
+            }
+        } else if (index > gap_begin_) {
+            const size_t count = index - gap_begin_;
+            if constexpr (is_trivially_relocatable_v<T>) {
+                std::memmove(static_cast<void *>(data_ + gap_begin_), static_cast<const void *>(data_ + gap_end_),
+                             count * sizeof(T));
+                gap_begin_ += count;
+                gap_end_ += count;
+            } else {
+                while (gap_begin_ < index) {
+                    RelocateOne(data_ + gap_end_, data_ + gap_begin_);
+                    ++gap_begin_;
+                    ++gap_end_;
+                }
+            }
+        }
+    }
+
+    static void RelocateOne(T *src, T *dst) {
+        if constexpr (detail::kMoveOnRelocate<T>) {
+            new(dst) T(std::move(*src));
+        } else {
+            new(dst) T(*src);
+        }
+        std::destroy_at(src);
+    }
+
+    RawMemory<T> data_;
+    size_t gap_begin_ = 0;
+    size_t gap_end_ = 0;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+// Политика роста определяет новую вместимость вектора, когда очередной элемент в него не помещается.
+// NextCapacity(capacity, required, elem_size) получает текущую вместимость, требуемое число
+// элементов и размер элемента в байтах и возвращает вместимость не меньше required.
+// Необязательный ShrinkCapacity(size, capacity, elem_size) вызывается после удаления элементов
+// и возвращает желаемую вместимость; значение меньше текущей вместимости уменьшает буфер
+
+// Удвоение вместимости: амортизированная O(1) вставка ценой до 50% неиспользуемой памяти
+struct DoublingGrowth {
+    static constexpr std::string_view kName = "2x";
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*elem_size*/) noexcept {
+        const size_t grown = capacity == 0 ? 1 : 2 * capacity;
+        return grown < required ? required : grown;
+    }
+};
+
+// Рост в 1.5 раза. Сумма ранее освобождённых блоков со временем превышает размер следующего,
+// и аллокатор может переиспользовать их память; в худшем случае простаивает треть буфера
+struct OneAndHalfGrowth {
+    static constexpr std::string_view kName = "1.5x";
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t /*elem_size*/) noexcept {
+        const size_t grown = capacity + (capacity / 2 > 0 ? capacity / 2 : 1);
+        return grown < required ? required : grown;
+    }
+};
+
+// Первое выделение занимает целую кэш-линию, чтобы маленькие векторы не перевыделялись
+// на каждом из первых элементов; дальше работает политика Base
+template<typename Base = DoublingGrowth, size_t CacheLine = 64>
+struct CacheLineGrowth {
+    static constexpr std::string_view kName = "cache-line first";
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t elem_size) noexcept {
+        if (capacity == 0) {
+            const size_t per_line = elem_size < CacheLine ? CacheLine / elem_size : 1;
+            return per_line < required ? required : per_line;
+        }
+        return Base::NextCapacity(capacity, required, elem_size);
+    }
+};
+
+// Вместимость по политике Base округляется вверх до целого числа страниц PageSize,
+// чтобы хвост последней страницы буфера не пропадал
+template<size_t PageSize = 4096, typename Base = DoublingGrowth>
+struct PageRoundedGrowth {
+    static_assert((PageSize & (PageSize - 1)) == 0, "page size must be a power of two");
+
+    static constexpr std::string_view kName = PageSize >= (size_t{2} << 20) ? "2 MiB pages" : "4 KiB pages";
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t elem_size) noexcept {
+        const size_t grown = Base::NextCapacity(capacity, required, elem_size);
+        const size_t bytes = (grown * elem_size + PageSize - 1) & ~(PageSize - 1);
+        return bytes / elem_size;
+    }
+};
+
+using HugePageRoundedGrowth = PageRoundedGrowth<size_t{2} << 20>;
+
+// Добавляет к политике Base автоматическое освобождение памяти: когда размер падает ниже
+// capacity / ShrinkBelow, вместимость уменьшается до size * ShrinkTo. Так как ShrinkTo < ShrinkBelow,
+// после уменьшения вектор может и вырасти в ShrinkTo раз, и сократиться ещё вдвое,
+// не вызывая новой реаллокации, и не колеблется между ростом и уменьшением.
+// Вместимость не опускается ниже MinCapacity: иначе опустевший вектор освобождал бы блок,
+// и чередование добавления и удаления у пустой границы выделяло бы память на каждом шаге
+template<typename Base = DoublingGrowth, size_t ShrinkBelow = 4, size_t ShrinkTo = 2, size_t MinCapacity = 16>
+struct AutoShrink {
+    static_assert(1 <= ShrinkTo && ShrinkTo < ShrinkBelow, "shrink target must leave a hysteresis gap");
+    static_assert(MinCapacity > 0, "empty vector must keep its block");
+
+    static constexpr std::string_view kName = Base::kName;
+
+    static size_t NextCapacity(size_t capacity, size_t required, size_t elem_size) noexcept {
+        return Base::NextCapacity(capacity, required, elem_size);
+    }
+
+    static size_t ShrinkCapacity(size_t size, size_t capacity, size_t /*elem_size*/) noexcept {
+        if (size * ShrinkBelow >= capacity) {
+            return capacity;
+        }
+        const size_t target = std::max(size * ShrinkTo, MinCapacity);
+        return target < capacity ? target : capacity;
+    }
+};
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+// Аллокатор на malloc/realloc/free, умеющий расширять блок на месте и выделять обнулённую память.
+// Блоки от kMmapThreshold байт на Linux берутся напрямую через mmap и растут через mremap:
+// ядро переназначает страницы, не копируя данные. Vector использует reallocate
+// только для тривиально перемещаемых элементов, для которых перенос байтов корректен
+template<typename T>
+class MallocAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "malloc does not provide extended alignment");
+
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    static constexpr size_t kMmapThreshold = size_t{4} << 20;
+
+    MallocAllocator() noexcept = default;
+
+    template<typename U>
+    MallocAllocator(const MallocAllocator<U> & /*other*/) noexcept {
+    }
+
+    T *allocate(size_t n) {
+        const size_t bytes = ToBytes(n);
+        void *p = IsMapped(bytes) ? Map(bytes) : std::malloc(bytes);
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(p);
+    }
+
+    // Выделяет память, заполненную нулями. Крупный блок берётся из mmap: ядро отдаёт
+    // нулевые страницы лениво, при первом обращении к ним
+    T *allocate_zeroed(size_t n) {
+        const size_t bytes = ToBytes(n);
+        void *p = IsMapped(bytes) ? Map(bytes) : std::calloc(1, bytes);
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(p);
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        const size_t bytes = n * sizeof(T);
+        if (IsMapped(bytes)) {
+            Unmap(p, bytes);
+        } else {
+            std::free(p);
+        }
+    }
+
+    // Меняет размер блока p с old_n на new_n элементов, сохраняя его байты.
+    // Возвращает новый адрес блока (возможно, прежний). При нехватке памяти бросает
+    // std::bad_alloc, и блок p остаётся действительным
+    T *reallocate(T *p, size_t old_n, size_t new_n) {
+        const size_t old_bytes = old_n * sizeof(T);
+        const size_t new_bytes = ToBytes(new_n);
+        void *result = nullptr;
+        if (!IsMapped(old_bytes) && !IsMapped(new_bytes)) {
+            result = std::realloc(static_cast<void *>(p), new_bytes);
+        } else if (IsMapped(old_bytes) && IsMapped(new_bytes)) {
+            result = Remap(p, old_bytes, new_bytes);
+        } else {
+            // Блок переходит между malloc и mmap, перенос только копированием
+            T *new_p = allocate(new_n);
+            std::memcpy(static_cast<void *>(new_p), static_cast<const void *>(p),
+                        old_bytes < new_bytes ? old_bytes : new_bytes);
+            deallocate(p, old_n);
+            return new_p;
+        }
+        if (result == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(result);
+    }
+
+    template<typename U>
+    struct rebind {
+        using other = MallocAllocator<U>;
+    };
+
+    friend bool operator==(const MallocAllocator & /*lhs*/, const MallocAllocator & /*rhs*/) noexcept {
+        return true;
+    }
+
+    friend bool operator!=(const MallocAllocator & /*lhs*/, const MallocAllocator & /*rhs*/) noexcept {
+        return false;
+    }
+
+private:
+    static size_t ToBytes(size_t n) {
+        if (n > static_cast<size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return n * sizeof(T);
+    }
+
+#if defined(__linux__)
+    static bool IsMapped(size_t bytes) noexcept {
+        return bytes >= kMmapThreshold;
+    }
+
+    static void *Map(size_t bytes) noexcept {
+        void *p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p != MAP_FAILED ? p : nullptr;
+    }
+
+    static void Unmap(void *p, size_t bytes) noexcept {
+        munmap(p, bytes);
+    }
+
+    static void *Remap(void *p, size_t old_bytes, size_t new_bytes) noexcept {
+        void *result = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+        return result != MAP_FAILED ? result : nullptr;
+    }
+#else
+    // Без mremap крупные блоки тоже обслуживает realloc
+    static bool IsMapped(size_t /*bytes*/) noexcept {
+        return false;
+    }
+
+    static void *Map(size_t bytes) noexcept {
+        return std::malloc(bytes);
+    }
+
+    static void Unmap(void *p, size_t /*bytes*/) noexcept {
+        std::free(p);
+    }
+
+    static void *Remap(void *p, size_t /*old_bytes*/, size_t new_bytes) noexcept {
+        return std::realloc(p, new_bytes);
+    }
+#endif
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+// Политика параллельного выполнения операций над большими векторами: значение передаётся
+// дополнительным аргументом в конструкторы, Reserve и Clear. Элементы делятся на равные куски,
+// каждый поток конструирует свой кусок и тем самым первым касается его страниц
+struct ParallelPolicy {
+    // Число потоков вместе с вызывающим; 0 означает std::thread::hardware_concurrency()
+    unsigned threads = 0;
+    // Кусок меньше этого числа элементов не окупает запуск потока
+    size_t min_chunk = size_t{1} << 16;
+};
+
+inline constexpr ParallelPolicy kParallel{};
+
+namespace detail {
+    inline size_t ChunkCount(size_t n, const ParallelPolicy &policy) noexcept {
+        const size_t threads = policy.threads != 0 ? policy.threads
+                                                   : std::max(1u, std::thread::hardware_concurrency());
+        return std::max<size_t>(1, std::min(threads, n / std::max<size_t>(policy.min_chunk, 1)));
+    }
+
+    // Пустая отмена для операций, которые нечего откатывать
+    struct NoUndo {
+        void operator()(size_t, size_t) const noexcept {
+        }
+    };
+
+    // Делит [0, n) на куски и выполняет op(first, count) для каждого в отдельном потоке,
+    // первый кусок обрабатывает вызывающий поток. op над куском либо выполняется целиком,
+    // либо не оставляет следов. Если хоть один кусок завершился исключением, для всех успешных
+    // вызывается undo(first, count), и первое исключение пробрасывается дальше
+    template<typename Op, typename Undo = NoUndo>
+    void ParallelChunks(size_t n, const ParallelPolicy &policy, Op op, Undo undo = Undo()) {
+        const size_t chunks = ChunkCount(n, policy);
+        if (chunks == 1) {
+            op(size_t{0}, n);
+            return;
+        }
+        const auto chunk_begin = [n, chunks](size_t i) {
+            return n / chunks * i + std::min(i, n % chunks);
+        };
+        std::vector<std::exception_ptr> errors;
+        std::vector<std::thread> workers;
+        try {
+            errors.resize(chunks);
+            workers.reserve(chunks - 1);
+        } catch (const std::bad_alloc &) {
+            // Без памяти под служебные данные работа выполняется в вызывающем потоке
+            op(size_t{0}, n);
+            return;
+        }
+        const auto run = [&](size_t i) noexcept {
+            try {
+                op(chunk_begin(i), chunk_begin(i + 1) - chunk_begin(i));
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        for (size_t i = 1; i < chunks; ++i) {
+            try {
+                workers.emplace_back(run, i);
+            } catch (const std::system_error &) {
+                // Поток создать не удалось, кусок обрабатывается синхронно
+                run(i);
+            }
+        }
+        run(0);
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
+
+        const auto failed = std::find_if(errors.begin(), errors.end(), [](const std::exception_ptr &error) {
+            return error != nullptr;
+        });
+        if (failed != errors.end()) {
+            for (size_t i = 0; i < chunks; ++i) {
+                if (errors[i] == nullptr) {
+                    undo(chunk_begin(i), chunk_begin(i + 1) - chunk_begin(i));
+                }
+            }
+            std::rethrow_exception(*failed);
+        }
+    }
+}  // namespace detail
@@ -0,0 +1,391 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Кольцевой буфер на RawMemory: добавление и удаление с обоих концов за O(1).
+// Вместимость всегда степень двойки, поэтому позиция элемента в буфере вычисляется маской.
+// При росте кольцо разворачивается в начало нового буфера одним переносом.
+// Linearize() делает элементы непрерывными для вызывающих, которым нужен указатель
+template<typename T>
+class RingVector {
+    template<bool IsConst>
+    class Iterator {
+        using Owner = std::conditional_t<IsConst, const RingVector, RingVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        Iterator() = default;
+
+        Iterator(Owner *owner, size_t index) noexcept
+                : owner_(owner), index_(index) {
+        }
+
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst> &other) noexcept
+                : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        Iterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        Iterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator old = *this;
+            --index_;
+            return old;
+        }
+
+        Iterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator<=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+        friend class Iterator<!IsConst>;
+
+        Owner *owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    RingVector() = default;
+
+    RingVector(const RingVector &other)
+            : data_(RoundUpCapacity(other.size_)) {
+        const auto [first, first_count, second, second_count] = other.Parts();
+        detail::UninitializedCopyN(first, first_count, data_.GetAddress());
+        try {
+            detail::UninitializedCopyN(second, second_count, data_ + first_count);
+        } catch (...) {
+            detail::DestroyN(data_.GetAddress(), first_count);
+            throw;
+        }
+        size_ = other.size_;
+    }
+
+    RingVector(RingVector &&other) noexcept
+            : data_(std::move(other.data_)),
+              head_(std::exchange(other.head_, 0)),
+              size_(std::exchange(other.size_, 0)) {
+    }
+
+    RingVector &operator=(const RingVector &rhs) {
+        if (this != &rhs) {
+            RingVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    RingVector &operator=(RingVector &&rhs) noexcept {
+        if (this != &rhs) {
+            RingVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    void Swap(RingVector &other) noexcept {
+        data_.Swap(other.data_);
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+    }
+
+    ~RingVector() {
+        const auto [first, first_count, second, second_count] = Parts();
+        detail::DestroyN(first, first_count);
+        detail::DestroyN(second, second_count);
+    }
+
+    // Вместимость округляется вверх до степени двойки
+    void Reserve(size_t new_capacity) {
+        if (new_capacity > data_.Capacity()) {
+            RawMemory<T> new_data(RoundUpCapacity(new_capacity));
+            UnrollInto(new_data.GetAddress());
+            data_.Swap(new_data);
+            head_ = 0;
+        }
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return data_.Capacity();
+    }
+
+    bool IsEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<RingVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return data_[Wrap(head_ + index)];
+    }
+
+    T &Front() noexcept {
+        return (*this)[0];
+    }
+
+    const T &Front() const noexcept {
+        return (*this)[0];
+    }
+
+    T &Back() noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    const T &Back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    template<typename E>
+    void PushBack(E &&elem) {
+        EmplaceBack(std::forward<E>(elem));
+    }
+
+    template<typename E>
+    void PushFront(E &&elem) {
+        EmplaceFront(std::forward<E>(elem));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        if (size_ == data_.Capacity()) {
+            // Новый элемент создаётся до переноса: аргументы могут ссылаться на элементы кольца
+            RawMemory<T> new_data(NextCapacity());
+            T *added = new(new_data + size_) T(std::forward<Args>(args)...);
+            Adopt(new_data, added, 0);
+        } else {
+            new(data_ + Wrap(head_ + size_)) T(std::forward<Args>(args)...);
+        }
+        ++size_;
+        return Back();
+    }
+
+    template<typename... Args>
+    T &EmplaceFront(Args &&... args) {
+        if (size_ == data_.Capacity()) {
+            // Новый элемент занимает последнюю ячейку нового буфера, а кольцо разворачивается
+            // в его начало, так что порядок сохраняется через переход по кругу
+            RawMemory<T> new_data(NextCapacity());
+            const size_t new_head = new_data.Capacity() - 1;
+            T *added = new(new_data + new_head) T(std::forward<Args>(args)...);
+            Adopt(new_data, added, new_head);
+        } else {
+            const size_t new_head = Wrap(head_ + data_.Capacity() - 1);
+            new(data_ + new_head) T(std::forward<Args>(args)...);
+            head_ = new_head;
+        }
+        ++size_;
+        return Front();
+    }
+
+    void PopBack() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(&Back());
+        --size_;
+    }
+
+    void PopFront() noexcept {
+        assert(size_ > 0);
+        std::destroy_at(&Front());
+        head_ = Wrap(head_ + 1);
+        --size_;
+    }
+
+    // Переносит элементы в начало буфера (в тот же или новый блок той же вместимости)
+    // и возвращает указатель на первый. Если кольцо уже непрерывно, ничего не переносит
+    T *Linearize() {
+        if (head_ + size_ > data_.Capacity()) {
+            RawMemory<T> new_data(data_.Capacity());
+            UnrollInto(new_data.GetAddress());
+            data_.Swap(new_data);
+            head_ = 0;
+        }
+        return data_ + head_;
+    }
+
+    iterator begin() noexcept {
+        return {this, 0};
+    }
+
+    iterator end() noexcept {
+        return {this, size_};
+    }
+
+    const_iterator begin() const noexcept {
+        return {this, 0};
+    }
+
+    const_iterator end() const noexcept {
+        return {this, size_};
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Две непрерывные части кольца: от head_ до конца буфера и от начала буфера
+    struct RingParts {
+        T *first;
+        size_t first_count;
+        T *second;
+        size_t second_count;
+    };
+
+    RingParts Parts() const noexcept {
+        T *buffer = const_cast<T *>(data_.GetAddress());
+        const size_t first_count = std::min(size_, data_.Capacity() - head_);
+        return {buffer + head_, first_count, buffer, size_ - first_count};
+    }
+
+    size_t Wrap(size_t index) const noexcept {
+        return index & (data_.Capacity() - 1);
+    }
+
+    static size_t RoundUpCapacity(size_t n) noexcept {
+        size_t capacity = 1;
+        while (capacity < n) {
+            capacity *= 2;
+        }
+        return n == 0 ? 0 : capacity;
+    }
+
+    size_t NextCapacity() const noexcept {
+        return data_.Capacity() == 0 ? 1 : data_.Capacity() * 2;
+    }
+
+    // Переносит кольцо в dst[0, size_). Исходные элементы уничтожаются, только когда перенесены
+    // обе части, поэтому при исключении кольцо остаётся нетронутым
+    void UnrollInto(T *dst) {
+        const auto [first, first_count, second, second_count] = Parts();
+        if constexpr (is_trivially_relocatable_v<T>) {
+            detail::RelocateN(first, first_count, dst);
+            detail::RelocateN(second, second_count, dst + first_count);
+        } else {
+            detail::UninitializedTransferN(first, first_count, dst);
+            try {
+                detail::UninitializedTransferN(second, second_count, dst + first_count);
+            } catch (...) {
+                detail::DestroyN(dst, first_count);
+                throw;
+            }
+            detail::DestroyN(first, first_count);
+            detail::DestroyN(second, second_count);
+        }
+    }
+
+    // Разворачивает кольцо в начало new_data и забирает буфер. Ячейку added уже занимает
+    // добавляемый элемент, при исключении он уничтожается
+    void Adopt(RawMemory<T> &new_data, T *added, size_t new_head) {
+        try {
+            UnrollInto(new_data.GetAddress());
+        } catch (...) {
+            std::destroy_at(added);
+            throw;
+        }
+        data_.Swap(new_data);
+        head_ = new_head;
+    }
+
+    RawMemory<T> data_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
@@ -0,0 +1,331 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Вектор из блоков RawMemory по 2^BlockShift элементов, адреса которых хранятся в каталоге Vector.
+// При росте добавляется новый блок, а уже созданные элементы не перемещаются: указатели и ссылки
+// на них остаются действительными до удаления самих элементов. Индекс раскладывается на номер
+// блока и смещение сдвигом и маской. Итераторы, как у std::deque, добавление элементов делает
+// недействительными, так как каталог может перевыделиться
+template<typename T, size_t BlockShift = 10>
+class SegmentedVector {
+    using Block = RawMemory<T>;
+
+    static constexpr size_t kBlockSize = size_t{1} << BlockShift;
+    static constexpr size_t kBlockMask = kBlockSize - 1;
+
+    template<bool IsConst>
+    class Iterator {
+        using BlockPtr = std::conditional_t<IsConst, const Block *, Block *>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T *, T *>;
+        using reference = std::conditional_t<IsConst, const T &, T &>;
+
+        Iterator() = default;
+
+        Iterator(BlockPtr blocks, size_t index) noexcept
+                : blocks_(blocks), index_(index) {
+        }
+
+        // Неконстантный итератор приводится к константному
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        Iterator(const Iterator<OtherConst> &other) noexcept
+                : blocks_(other.blocks_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return blocks_[index_ >> BlockShift][index_ & kBlockMask];
+        }
+
+        pointer operator->() const noexcept {
+            return &**this;
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        Iterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        Iterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            Iterator old = *this;
+            --index_;
+            return old;
+        }
+
+        Iterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        Iterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator<=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>=(const Iterator &lhs, const Iterator &rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+    private:
+        friend class Iterator<!IsConst>;
+
+        BlockPtr blocks_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    SegmentedVector() = default;
+
+    explicit SegmentedVector(size_t size) {
+        Resize(size);
+    }
+
+    SegmentedVector(const SegmentedVector &other) {
+        Reserve(other.size_);
+        try {
+            other.ForEachChunk(0, other.size_, [this](const T *src, size_t count) {
+                detail::UninitializedCopyN(src, count, Slot(size_));
+                size_ += count;
+            });
+        } catch (...) {
+            DestroyRange(0, size_);
+            throw;
+        }
+    }
+
+    SegmentedVector(SegmentedVector &&other) noexcept
+            : blocks_(std::move(other.blocks_)), size_(std::exchange(other.size_, 0)) {
+    }
+
+    SegmentedVector &operator=(const SegmentedVector &rhs) {
+        if (this != &rhs) {
+            SegmentedVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SegmentedVector &operator=(SegmentedVector &&rhs) noexcept {
+        if (this != &rhs) {
+            DestroyRange(0, size_);
+            blocks_ = std::move(rhs.blocks_);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    void Swap(SegmentedVector &other) noexcept {
+        blocks_.Swap(other.blocks_);
+        std::swap(size_, other.size_);
+    }
+
+    ~SegmentedVector() {
+        DestroyRange(0, size_);
+    }
+
+    // Выделяет недостающие блоки; существующие элементы остаются на месте
+    void Reserve(size_t new_capacity) {
+        const size_t blocks = (new_capacity + kBlockMask) >> BlockShift;
+        if (blocks > blocks_.Size()) {
+            blocks_.Reserve(blocks);
+            while (blocks_.Size() < blocks) {
+                blocks_.EmplaceBack(kBlockSize);
+            }
+        }
+    }
+
+    // Освобождает блоки, в которых не осталось элементов
+    void ShrinkToFit() {
+        const size_t blocks = (size_ + kBlockMask) >> BlockShift;
+        while (blocks_.Size() > blocks) {
+            blocks_.PopBack();
+        }
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return blocks_.Size() << BlockShift;
+    }
+
+    static constexpr size_t BlockSize() noexcept {
+        return kBlockSize;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SegmentedVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return *Slot(index);
+    }
+
+    void Resize(size_t n) {
+        if (size_ < n) {
+            Reserve(n);
+            const size_t old_size = size_;
+            try {
+                ForEachChunk(old_size, n, [this](T *dst, size_t count) {
+                    std::uninitialized_value_construct_n(dst, count);
+                    size_ += count;
+                });
+            } catch (...) {
+                DestroyRange(old_size, size_);
+                size_ = old_size;
+                throw;
+            }
+        } else if (size_ > n) {
+            DestroyRange(n, size_);
+            size_ = n;
+        }
+    }
+
+    template<typename E>
+    void PushBack(E &&elem) {
+        EmplaceBack(std::forward<E>(elem));
+    }
+
+    // Аргументы могут ссылаться на элементы этого же вектора: при росте они не перемещаются
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        if (size_ == Capacity()) {
+            blocks_.EmplaceBack(kBlockSize);
+        }
+        T *elem = new(Slot(size_)) T(std::forward<Args>(args)...);
+        ++size_;
+        return *elem;
+    }
+
+    void PopBack() {
+        if (size_ > 0) {
+            --size_;
+            std::destroy_at(Slot(size_));
+        }
+    }
+
+    iterator begin() noexcept {
+        return {blocks_.begin(), 0};
+    }
+
+    iterator end() noexcept {
+        return {blocks_.begin(), size_};
+    }
+
+    const_iterator begin() const noexcept {
+        return {blocks_.begin(), 0};
+    }
+
+    const_iterator end() const noexcept {
+        return {blocks_.begin(), size_};
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    // Адрес ячейки index в пределах вместимости
+    T *Slot(size_t index) noexcept {
+        return blocks_[index >> BlockShift] + (index & kBlockMask);
+    }
+
+    // Вызывает f(ptr, count) для непрерывных кусков элементов [first, last) по блокам
+    template<typename F>
+    void ForEachChunk(size_t first, size_t last, F f) {
+        while (first < last) {
+            const size_t count = std::min(last - first, kBlockSize - (first & kBlockMask));
+            f(Slot(first), count);
+            first += count;
+        }
+    }
+
+    template<typename F>
+    void ForEachChunk(size_t first, size_t last, F f) const {
+        const_cast<SegmentedVector &>(*this).ForEachChunk(first, last, [&f](T *ptr, size_t count) {
+            f(static_cast<const T *>(ptr), count);
+        });
+    }
+
+    void DestroyRange(size_t first, size_t last) noexcept {
+        ForEachChunk(first, last, [](T *ptr, size_t count) noexcept {
+            detail::DestroyN(ptr, count);
+        });
+    }
+
+    Vector<Block> blocks_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// Вектор, хранящий до N элементов внутри самого объекта. Память в куче (RawMemory)
+// выделяется, только когда элементы перестают помещаться во встроенный буфер.
+// Интерфейс и гарантии безопасности исключений совпадают с Vector
+template<typename T, size_t N>
+class SmallVector {
+    static_assert(N > 0, "use Vector for containers without inline storage");
+
+public:
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    SmallVector() noexcept = default;
+
+    explicit SmallVector(size_t size) {
+        Reserve(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    SmallVector(const SmallVector &other) {
+        Reserve(other.size_);
+        std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        size_ = other.size_;
+    }
+
+    // Буфер из кучи забирается целиком, встроенные элементы переносятся поштучно
+    SmallVector(SmallVector &&other) noexcept(kNothrowRelocate) {
+        StealFrom(other);
+    }
+
+    SmallVector &operator=(const SmallVector &rhs) {
+        if (this != &rhs) {
+            if (rhs.size_ > Capacity()) {
+                SmallVector rhs_copy(rhs);
+                *this = std::move(rhs_copy);
+            } else if (rhs.size_ < size_) {
+                std::copy_n(rhs.Data(), rhs.size_, Data());
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+                size_ = rhs.size_;
+            } else {
+                std::copy_n(rhs.Data(), size_, Data());
+                std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&rhs) noexcept(kNothrowRelocate) {
+        if (this != &rhs) {
+            std::destroy_n(Data(), size_);
+            size_ = 0;
+            StealFrom(rhs);
+        }
+        return *this;
+    }
+
+    void Swap(SmallVector &other) noexcept(kNothrowRelocate) {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    ~SmallVector() {
+        std::destroy_n(Data(), size_);
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= Capacity()) {
+            return;
+        }
+        RawMemory<T> new_data(new_capacity);
+        detail::RelocateN(Data(), size_, new_data.GetAddress());
+        heap_ = std::move(new_data);
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return IsInline() ? N : heap_.Capacity();
+    }
+
+    // Элементы лежат во встроенном буфере
+    bool IsInline() const noexcept {
+        return heap_.GetAddress() == nullptr;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<SmallVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    void Resize(size_t n) {
+        if (size_ < n) {
+            Reserve(n);
+            std::uninitialized_value_construct_n(Data() + size_, n - size_);
+        } else if (size_ > n) {
+            std::destroy_n(Data() + n, size_ - n);
+        }
+        size_ = n;
+    }
+
+    template<typename E>
+    void PushBack(E &&elem) {
+        EmplaceBack(std::forward<E>(elem));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        if (size_ == Capacity()) {
+            EmplaceWithReallocation(size_, std::forward<Args>(args)...);
+        } else {
+            new(Data() + size_) T(std::forward<Args>(args)...);
+            ++size_;
+        }
+        return Data()[size_ - 1];
+    }
+
+    void PopBack() {
+        if (size_ > 0) {
+            std::destroy_at(Data() + size_ - 1);
+            --size_;
+        }
+    }
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    template<typename... Args>
+    iterator Emplace(const_iterator pos, Args &&... args) {
+        assert(pos >= begin() && pos <= end());
+        const size_t pos_num = pos - begin();
+        if (size_ == Capacity()) {
+            return EmplaceWithReallocation(pos_num, std::forward<Args>(args)...);
+        }
+        if (pos_num == size_) {
+            return &EmplaceBack(std::forward<Args>(args)...);
+        }
+        // Временный объект защищает от вставки элемента этого же вектора
+        T tmp(std::forward<Args>(args)...);
+        new(end()) T(std::move(*(end() - 1)));
+        std::move_backward(begin() + pos_num, end() - 1, end());
+        Data()[pos_num] = std::move(tmp);
+        ++size_;
+        return begin() + pos_num;
+    }
+
+    iterator Erase(const_iterator pos) {
+        assert(pos >= begin() && pos < end());
+        const size_t offset = pos - begin();
+        std::move(begin() + offset + 1, end(), begin() + offset);
+        std::destroy_at(end() - 1);
+        --size_;
+        return begin() + offset;
+    }
+
+    template<typename Arg>
+    iterator Insert(const_iterator pos, Arg &&arg) {
+        return Emplace(pos, std::forward<Arg>(arg));
+    }
+
+private:
+    static constexpr bool kNothrowRelocate = is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+    T *Data() noexcept {
+        return IsInline() ? std::launder(reinterpret_cast<T *>(inline_)) : heap_.GetAddress();
+    }
+
+    const T *Data() const noexcept {
+        return const_cast<SmallVector &>(*this).Data();
+    }
+
+    // Забирает содержимое other в пустой *this
+    void StealFrom(SmallVector &other) noexcept(kNothrowRelocate) {
+        assert(size_ == 0);
+        if (!other.IsInline()) {
+            heap_ = std::move(other.heap_);
+        } else {
+            detail::RelocateN(other.Data(), other.size_, Data());
+        }
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    template<typename... Args>
+    iterator EmplaceWithReallocation(size_t pos, Args &&... args) {
+        RawMemory<T> new_data(DoublingGrowth::NextCapacity(Capacity(), size_ + 1, sizeof(T)));
+        new(new_data + pos) T(std::forward<Args>(args)...);
+        try {
+            detail::RelocateWithGap(Data(), size_, pos, 1, new_data.GetAddress());
+        } catch (...) {
+            std::destroy_at(new_data + pos);
+            throw;
+        }
+        heap_ = std::move(new_data);
+        ++size_;
+        return begin() + pos;
+    }
+
+    RawMemory<T> heap_;
+    size_t size_ = 0;
+    alignas(T) std::byte inline_[N * sizeof(T)];
+};
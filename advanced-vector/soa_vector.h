@@ -0,0 +1,434 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Непрерывный участок одного столбца SoAVector. Действителен до изменения вместимости вектора
+template<typename T>
+class ColumnSpan {
+public:
+    ColumnSpan(T *data, size_t size) noexcept
+            : data_(data), size_(size) {
+    }
+
+    T *Data() const noexcept {
+        return data_;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    T &operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return data_[index];
+    }
+
+    T *begin() const noexcept {
+        return data_;
+    }
+
+    T *end() const noexcept {
+        return data_ + size_;
+    }
+
+private:
+    T *data_;
+    size_t size_;
+};
+
+// Вектор записей, хранящий каждое поле в отдельном столбце (structure of arrays): цикл по одному
+// полю читает только его байты и векторизуется компилятором. Все столбцы лежат в одном блоке памяти,
+// каждый выровнен по кэш-линии, и растут одним выделением. Строка представлена кортежем ссылок
+// std::tuple<Ts &...>, поэтому итератор строк подходит для алгоритмов, которые читают строки
+// или присваивают им значения (find_if, count_if, copy, transform)
+template<typename... Ts>
+class SoAVector {
+    static_assert(sizeof...(Ts) > 0, "SoAVector needs at least one column");
+
+    static constexpr size_t kColumns = sizeof...(Ts);
+    static constexpr size_t kAlignment = 64;
+
+    template<size_t I>
+    using Column = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    // Единица выделения памяти: блок из них выровнен по кэш-линии
+    struct alignas(kAlignment) CacheLine {
+        std::byte bytes[kAlignment];
+    };
+
+    using Columns = std::tuple<Ts *...>;
+
+    // Блок памяти и начала столбцов в нём
+    struct Storage {
+        RawMemory<CacheLine> block;
+        Columns columns{};
+    };
+
+    template<bool IsConst>
+    class RowIterator {
+        using Owner = std::conditional_t<IsConst, const SoAVector, SoAVector>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, std::tuple<const Ts &...>, std::tuple<Ts &...>>;
+        using pointer = void;
+
+        RowIterator() = default;
+
+        RowIterator(Owner *owner, size_t index) noexcept
+                : owner_(owner), index_(index) {
+        }
+
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        RowIterator(const RowIterator<OtherConst> &other) noexcept
+                : owner_(other.owner_), index_(other.index_) {
+        }
+
+        reference operator*() const noexcept {
+            return (*owner_)[index_];
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        RowIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        RowIterator operator++(int) noexcept {
+            RowIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        RowIterator &operator--() noexcept {
+            --index_;
+            return *this;
+        }
+
+        RowIterator operator--(int) noexcept {
+            RowIterator old = *this;
+            --index_;
+            return old;
+        }
+
+        RowIterator &operator+=(difference_type n) noexcept {
+            index_ += n;
+            return *this;
+        }
+
+        RowIterator &operator-=(difference_type n) noexcept {
+            index_ -= n;
+            return *this;
+        }
+
+        friend RowIterator operator+(RowIterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend RowIterator operator+(difference_type n, RowIterator it) noexcept {
+            return it += n;
+        }
+
+        friend RowIterator operator-(RowIterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+        }
+
+        friend bool operator==(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ != rhs.index_;
+        }
+
+        friend bool operator<(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ < rhs.index_;
+        }
+
+        friend bool operator>(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ > rhs.index_;
+        }
+
+        friend bool operator<=(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ <= rhs.index_;
+        }
+
+        friend bool operator>=(const RowIterator &lhs, const RowIterator &rhs) noexcept {
+            return lhs.index_ >= rhs.index_;
+        }
+
+        size_t Index() const noexcept {
+            return index_;
+        }
+
+    private:
+        friend class RowIterator<!IsConst>;
+
+        Owner *owner_ = nullptr;
+        size_t index_ = 0;
+    };
+
+public:
+    using iterator = RowIterator<false>;
+    using const_iterator = RowIterator<true>;
+    using row = std::tuple<Ts &...>;
+    using const_row = std::tuple<const Ts &...>;
+
+    SoAVector() = default;
+
+    SoAVector(const SoAVector &other)
+            : storage_(MakeStorage(other.size_)), capacity_(other.size_) {
+        CopyColumns(other.storage_.columns, other.size_, std::index_sequence_for<Ts...>());
+        size_ = other.size_;
+    }
+
+    SoAVector(SoAVector &&other) noexcept
+            : storage_(std::move(other.storage_)),
+              size_(std::exchange(other.size_, 0)),
+              capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    SoAVector &operator=(const SoAVector &rhs) {
+        if (this != &rhs) {
+            SoAVector rhs_copy(rhs);
+            Swap(rhs_copy);
+        }
+        return *this;
+    }
+
+    SoAVector &operator=(SoAVector &&rhs) noexcept {
+        if (this != &rhs) {
+            SoAVector rhs_moved(std::move(rhs));
+            Swap(rhs_moved);
+        }
+        return *this;
+    }
+
+    void Swap(SoAVector &other) noexcept {
+        storage_.block.Swap(other.storage_.block);
+        std::swap(storage_.columns, other.storage_.columns);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    ~SoAVector() {
+        DestroyRows(storage_.columns, 0, size_, std::index_sequence_for<Ts...>());
+    }
+
+    void Reserve(size_t new_capacity) {
+        if (new_capacity <= capacity_) {
+            return;
+        }
+        Storage new_storage = MakeStorage(new_capacity);
+        RelocateColumns(new_storage.columns, std::index_sequence_for<Ts...>());
+        storage_ = std::move(new_storage);
+        capacity_ = new_capacity;
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    size_t Capacity() const noexcept {
+        return capacity_;
+    }
+
+    // Столбец поля I целиком
+    template<size_t I>
+    ColumnSpan<Column<I>> Span() noexcept {
+        return {std::get<I>(storage_.columns), size_};
+    }
+
+    template<size_t I>
+    ColumnSpan<const Column<I>> Span() const noexcept {
+        return {std::get<I>(storage_.columns), size_};
+    }
+
+    row operator[](size_t index) noexcept {
+        assert(index < size_);
+        return std::apply([index](Ts *... columns) {
+            return row(columns[index]...);
+        }, storage_.columns);
+    }
+
+    const_row operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return std::apply([index](Ts *... columns) {
+            return const_row(columns[index]...);
+        }, storage_.columns);
+    }
+
+    // Добавляет строку, по одному аргументу на столбец. Аргументы могут ссылаться на поля этого же вектора
+    template<typename... Args>
+    row EmplaceBack(Args &&... args) {
+        static_assert(sizeof...(Args) == kColumns, "EmplaceBack takes one argument per column");
+        if (size_ == capacity_) {
+            const size_t new_capacity = DoublingGrowth::NextCapacity(capacity_, size_ + 1, RowSize());
+            Storage new_storage = MakeStorage(new_capacity);
+            ConstructRow<0>(new_storage.columns, size_, std::forward_as_tuple(std::forward<Args>(args)...));
+            try {
+                RelocateColumns(new_storage.columns, std::index_sequence_for<Ts...>());
+            } catch (...) {
+                DestroyRows(new_storage.columns, size_, size_ + 1, std::index_sequence_for<Ts...>());
+                throw;
+            }
+            storage_ = std::move(new_storage);
+            capacity_ = new_capacity;
+        } else {
+            ConstructRow<0>(storage_.columns, size_, std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+        ++size_;
+        return (*this)[size_ - 1];
+    }
+
+    void PopBack() noexcept {
+        if (size_ > 0) {
+            DestroyRows(storage_.columns, size_ - 1, size_, std::index_sequence_for<Ts...>());
+            --size_;
+        }
+    }
+
+    // Удаляет строку, сдвигая следующие строки каждого столбца на одну позицию
+    iterator Erase(const_iterator pos) {
+        assert(pos >= cbegin() && pos < cend());
+        const size_t index = pos.Index();
+        ShiftLeft(index, std::index_sequence_for<Ts...>());
+        PopBack();
+        return begin() + index;
+    }
+
+    void Clear() noexcept {
+        DestroyRows(storage_.columns, 0, size_, std::index_sequence_for<Ts...>());
+        size_ = 0;
+    }
+
+    iterator begin() noexcept {
+        return {this, 0};
+    }
+
+    iterator end() noexcept {
+        return {this, size_};
+    }
+
+    const_iterator begin() const noexcept {
+        return {this, 0};
+    }
+
+    const_iterator end() const noexcept {
+        return {this, size_};
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+private:
+    static constexpr size_t RowSize() noexcept {
+        return (sizeof(Ts) + ...);
+    }
+
+    static constexpr size_t AlignUp(size_t bytes) noexcept {
+        return (bytes + kAlignment - 1) / kAlignment * kAlignment;
+    }
+
+    // Один блок, в котором столбцы идут друг за другом, каждый с начала кэш-линии
+    static Storage MakeStorage(size_t capacity) {
+        static_assert(((alignof(Ts) <= kAlignment) && ...), "column alignment exceeds a cache line");
+        const size_t bytes = (AlignUp(capacity * sizeof(Ts)) + ...);
+        Storage storage{RawMemory<CacheLine>(bytes / kAlignment)};
+        std::byte *next = reinterpret_cast<std::byte *>(storage.block.GetAddress());
+        const auto place = [&next, capacity](auto *&column) {
+            using T = std::remove_reference_t<decltype(*column)>;
+            column = reinterpret_cast<T *>(next);
+            next += AlignUp(capacity * sizeof(T));
+        };
+        std::apply([&place](auto &... columns) {
+            (place(columns), ...);
+        }, storage.columns);
+        return storage;
+    }
+
+    // Конструирует поля строки index начиная со столбца I; при исключении созданные поля уничтожаются
+    template<size_t I, typename ArgsTuple>
+    static void ConstructRow(const Columns &columns, size_t index, ArgsTuple &&args) {
+        if constexpr (I < kColumns) {
+            Column<I> *slot = std::get<I>(columns) + index;
+            new(slot) Column<I>(std::get<I>(std::move(args)));
+            try {
+                ConstructRow<I + 1>(columns, index, std::move(args));
+            } catch (...) {
+                std::destroy_at(slot);
+                throw;
+            }
+        }
+    }
+
+    template<size_t... I>
+    static void DestroyRows(const Columns &columns, size_t first, size_t last, std::index_sequence<I...>) noexcept {
+        (detail::DestroyN(std::get<I>(columns) + first, last - first), ...);
+    }
+
+    // Переносит все столбцы в new_columns. Исходные строки уничтожаются, только когда перенесены
+    // все столбцы, поэтому при исключении вектор остаётся нетронутым
+    template<size_t... I>
+    void RelocateColumns(const Columns &new_columns, std::index_sequence<I...>) {
+        if constexpr ((is_trivially_relocatable_v<Ts> && ...)) {
+            (detail::RelocateN(std::get<I>(storage_.columns), size_, std::get<I>(new_columns)), ...);
+        } else {
+            size_t transferred = 0;
+            try {
+                ((detail::UninitializedTransferN(std::get<I>(storage_.columns), size_, std::get<I>(new_columns)),
+                        ++transferred), ...);
+            } catch (...) {
+                ((I < transferred ? detail::DestroyN(std::get<I>(new_columns), size_) : void()), ...);
+                throw;
+            }
+            DestroyRows(storage_.columns, 0, size_, std::index_sequence<I...>());
+        }
+    }
+
+    // Копирует столбцы other в пустой вектор
+    template<size_t... I>
+    void CopyColumns(const Columns &other, size_t count, std::index_sequence<I...>) {
+        size_t copied = 0;
+        try {
+            ((detail::UninitializedCopyN(static_cast<const Ts *>(std::get<I>(other)), count,
+                                         std::get<I>(storage_.columns)), ++copied), ...);
+        } catch (...) {
+            ((I < copied ? detail::DestroyN(std::get<I>(storage_.columns), count) : void()), ...);
+            throw;
+        }
+    }
+
+    template<size_t... I>
+    void ShiftLeft(size_t index, std::index_sequence<I...>) {
+        (std::move(std::get<I>(storage_.columns) + index + 1, std::get<I>(storage_.columns) + size_,
+                   std::get<I>(storage_.columns) + index), ...);
+    }
+
+    Storage storage_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+};
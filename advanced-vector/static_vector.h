@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Вектор фиксированной вместимости N, который никогда не обращается к куче: все элементы
+// живут во встроенном выровненном буфере. Переполнение можно проверить через TryPushBack
+// и TryEmplaceBack, которые возвращают false; остальные методы при переполнении бросают
+// std::length_error
+template<typename T, size_t N>
+class StaticVector {
+public:
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    StaticVector() noexcept = default;
+
+    explicit StaticVector(size_t size) {
+        CheckCapacity(size);
+        std::uninitialized_value_construct_n(Data(), size);
+        size_ = size;
+    }
+
+    StaticVector(const StaticVector &other) {
+        CopyFrom(other);
+    }
+
+    StaticVector(StaticVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        MoveFrom(other);
+    }
+
+    StaticVector &operator=(const StaticVector &rhs) {
+        if (this != &rhs) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                CopyFrom(rhs);
+            } else if (rhs.size_ < size_) {
+                std::copy_n(rhs.Data(), rhs.size_, Data());
+                std::destroy_n(Data() + rhs.size_, size_ - rhs.size_);
+                size_ = rhs.size_;
+            } else {
+                std::copy_n(rhs.Data(), size_, Data());
+                std::uninitialized_copy_n(rhs.Data() + size_, rhs.size_ - size_, Data() + size_);
+                size_ = rhs.size_;
+            }
+        }
+        return *this;
+    }
+
+    StaticVector &operator=(StaticVector &&rhs) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &rhs) {
+            DestroyAll();
+            MoveFrom(rhs);
+        }
+        return *this;
+    }
+
+    ~StaticVector() {
+        DestroyAll();
+    }
+
+    size_t Size() const noexcept {
+        return size_;
+    }
+
+    static constexpr size_t Capacity() noexcept {
+        return N;
+    }
+
+    bool IsFull() const noexcept {
+        return size_ == N;
+    }
+
+    const T &operator[](size_t index) const noexcept {
+        return const_cast<StaticVector &>(*this)[index];
+    }
+
+    T &operator[](size_t index) noexcept {
+        assert(index < size_);
+        return Data()[index];
+    }
+
+    void Resize(size_t n) {
+        CheckCapacity(n);
+        if (size_ < n) {
+            std::uninitialized_value_construct_n(Data() + size_, n - size_);
+        } else if (size_ > n) {
+            std::destroy_n(Data() + n, size_ - n);
+        }
+        size_ = n;
+    }
+
+    template<typename E>
+    void PushBack(E &&elem) {
+        EmplaceBack(std::forward<E>(elem));
+    }
+
+    template<typename... Args>
+    T &EmplaceBack(Args &&... args) {
+        CheckCapacity(size_ + 1);
+        return EmplaceBackUnchecked(std::forward<Args>(args)...);
+    }
+
+    // Добавляет элемент, если есть место; при заполненном векторе возвращает false
+    template<typename E>
+    [[nodiscard]] bool TryPushBack(E &&elem) {
+        return TryEmplaceBack(std::forward<E>(elem));
+    }
+
+    template<typename... Args>
+    [[nodiscard]] bool TryEmplaceBack(Args &&... args) {
+        if (IsFull()) {
+            return false;
+        }
+        EmplaceBackUnchecked(std::forward<Args>(args)...);
+        return true;
+    }
+
+    void PopBack() {
+        if (size_ > 0) {
+            std::destroy_at(Data() + size_ - 1);
+            --size_;
+        }
+    }
+
+    iterator begin() noexcept {
+        return Data();
+    }
+
+    iterator end() noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator begin() const noexcept {
+        return Data();
+    }
+
+    const_iterator end() const noexcept {
+        return Data() + size_;
+    }
+
+    const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator cend() const noexcept {
+        return end();
+    }
+
+    template<typename... Args>
+    iterator Emplace(const_iterator pos, Args &&... args) {
+        assert(pos >= begin() && pos <= end());
+        CheckCapacity(size_ + 1);
+        const size_t pos_num = pos - begin();
+        if (pos_num == size_) {
+            return &EmplaceBackUnchecked(std::forward<Args>(args)...);
+        }
+        // Временный объект защищает от вставки элемента этого же вектора
+        T tmp(std::forward<Args>(args)...);
+        new(end()) T(std::move(*(end() - 1)));
+        std::move_backward(begin() + pos_num, end() - 1, end());
+        Data()[pos_num] = std::move(tmp);
+        ++size_;
+        return begin() + pos_num;
+    }
+
+    iterator Erase(const_iterator pos) {
+        assert(pos >= begin() && pos < end());
+        const size_t offset = pos - begin();
+        std::move(begin() + offset + 1, end(), begin() + offset);
+        std::destroy_at(end() - 1);
+        --size_;
+        return begin() + offset;
+    }
+
+    template<typename Arg>
+    iterator Insert(const_iterator pos, Arg &&arg) {
+        return Emplace(pos, std::forward<Arg>(arg));
+    }
+
+private:
+    T *Data() noexcept {
+        return std::launder(reinterpret_cast<T *>(storage_));
+    }
+
+    const T *Data() const noexcept {
+        return const_cast<StaticVector &>(*this).Data();
+    }
+
+    static void CheckCapacity(size_t n) {
+        if (n > N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+    }
+
+    template<typename... Args>
+    T &EmplaceBackUnchecked(Args &&... args) {
+        assert(size_ < N);
+        T *elem = new(Data() + size_) T(std::forward<Args>(args)...);
+        ++size_;
+        return *elem;
+    }
+
+    void DestroyAll() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_n(Data(), size_);
+        }
+        size_ = 0;
+    }
+
+    // Копирует other в пустой вектор или, для тривиально копируемых T, поверх текущих элементов.
+    // Копируется только занятая часть буфера, а не все N ячеек
+    void CopyFrom(const StaticVector &other) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (other.size_ != 0) {
+                std::memcpy(storage_, other.storage_, other.size_ * sizeof(T));
+            }
+        } else {
+            std::uninitialized_copy_n(other.Data(), other.size_, Data());
+        }
+        size_ = other.size_;
+    }
+
+    // Переносит элементы other в пустой вектор, other становится пустым
+    void MoveFrom(StaticVector &other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            CopyFrom(other);
+        } else {
+            std::uninitialized_move_n(other.Data(), other.size_, Data());
+            size_ = other.size_;
+        }
+        other.DestroyAll();
+    }
+
+    alignas(T) std::byte storage_[N * sizeof(T)];
+    size_t size_ = 0;
+};
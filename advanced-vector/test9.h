@@ -558,7 +558,9 @@ void Test12_6() {
         assert(Obj9::num_default_constructed == SIZE);
         assert(Obj9::num_constructed_with_id_and_name == 1);
         assert(Obj9::num_moved == old_num_moved + 1);
-        assert(Obj9::num_move_assigned == SIZE - 3);
+        // Аргументы (int, std::string) не могут ссылаться на элементы вектора,
+        // поэтому элемент собирается на месте без временного объекта
+        assert(Obj9::num_move_assigned == SIZE - 4);
         assert(Obj9::num_assigned == 0);
     }
     {
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "vector.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+namespace {
+
+    // Аллокатор с состоянием: помнит свой id и считает выделения в общей статистике
+    template<typename T, bool Propagate>
+    struct CountingAllocator {
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+        using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+        using propagate_on_container_swap = std::bool_constant<Propagate>;
+
+        explicit CountingAllocator(int id = 0) noexcept
+                : id(id) {
+        }
+
+        template<typename U>
+        CountingAllocator(const CountingAllocator<U, Propagate> &other) noexcept
+                : id(other.id) {
+        }
+
+        T *allocate(size_t n) {
+            ++num_allocations;
+            live_bytes += n * sizeof(T);
+            return static_cast<T *>(operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T *p, size_t n) noexcept {
+            ++num_deallocations;
+            live_bytes -= n * sizeof(T);
+            operator delete(p);
+        }
+
+        template<typename U>
+        struct rebind {
+            using other = CountingAllocator<U, Propagate>;
+        };
+
+        friend bool operator==(const CountingAllocator &lhs, const CountingAllocator &rhs) noexcept {
+            return lhs.id == rhs.id;
+        }
+
+        friend bool operator!=(const CountingAllocator &lhs, const CountingAllocator &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        static void ResetCounters() {
+            num_allocations = 0;
+            num_deallocations = 0;
+            live_bytes = 0;
+        }
+
+        int id = 0;
+
+        static inline int num_allocations = 0;
+        static inline int num_deallocations = 0;
+        static inline size_t live_bytes = 0;
+    };
+
+}  // namespace
+
+void TestAllocator_1() {
+    using Alloc = CountingAllocator<int, true>;
+    Alloc::ResetCounters();
+    {
+        Vector<int, Alloc> v{Alloc{1}};
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        v.Reserve(1000);
+        assert(v.GetAllocator().id == 1);
+        assert(Alloc::num_allocations > 0);
+        assert(Alloc::live_bytes == 1000 * sizeof(int));
+
+        Vector<int, Alloc> other(10, Alloc{2});
+        v.Swap(other);
+        assert(v.Size() == 10 && v.GetAllocator().id == 2);
+        assert(other.Size() == 100 && other.GetAllocator().id == 1);
+        assert(other[99] == 99);
+
+        v = std::move(other);
+        assert(v.Size() == 100 && v.GetAllocator().id == 1);
+        assert(v[42] == 42);
+
+        Vector<int, Alloc> copy(5, Alloc{3});
+        copy = v;
+        assert(copy.GetAllocator().id == 1);
+        assert(copy.Size() == 100 && copy[99] == 99);
+    }
+    assert(Alloc::live_bytes == 0);
+    assert(Alloc::num_allocations == Alloc::num_deallocations);
+}
+
+void TestAllocator_2() {
+    using Alloc = CountingAllocator<std::string, false>;
+    Alloc::ResetCounters();
+    {
+        Vector<std::string, Alloc> v(3, Alloc{1});
+        v[0] = "first";
+        Vector<std::string, Alloc> w(Alloc{2});
+        // Без propagate_on_container_move_assignment аллокатор приёмника сохраняется,
+        // а элементы перемещаются в его память
+        w = std::move(v);
+        assert(w.GetAllocator().id == 2);
+        assert(w.Size() == 3 && w[0] == "first");
+
+        Vector<std::string, Alloc> u(std::move(w), Alloc{3});
+        assert(u.GetAllocator().id == 3);
+        assert(u.Size() == 3 && u[0] == "first");
+
+        const Vector<std::string, Alloc> u_copy(u);
+        assert(u_copy.GetAllocator().id == 3);
+    }
+    assert(Alloc::live_bytes == 0);
+}
+
+void TestAllocator_3() {
+    std::array<std::byte, 4096> buffer{};
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(),
+                                                 std::pmr::null_memory_resource());
+    {
+        pmr::Vector<int> v(&resource);
+        for (int i = 0; i < 100; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == 100);
+        assert(v[99] == 99);
+        auto *first = reinterpret_cast<std::byte *>(&v[0]);
+        assert(first >= buffer.data() && first < buffer.data() + buffer.size());
+
+        // Копия получает ресурс по умолчанию, как и std::pmr::vector
+        pmr::Vector<int> copy(v);
+        assert(copy.GetAllocator().resource() == std::pmr::get_default_resource());
+
+        pmr::Vector<int> other(&resource);
+        other = std::move(copy);
+        assert(other.GetAllocator().resource() == &resource);
+        assert(other.Size() == 100 && other[50] == 50);
+    }
+}
+
+void TestAllocator_4() {
+    // 2M элементов по 8 байт: блок переходит с realloc на mmap и дальше растёт через mremap
+    const size_t SIZE = size_t{1} << 21;
+    {
+        Vector<uint64_t, MallocAllocator<uint64_t>> v;
+        for (size_t i = 0; i < SIZE; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Size() == SIZE);
+        assert(v.Capacity() == SIZE);
+        v.Emplace(v.cbegin() + 1, uint64_t{42});
+        assert(v.Capacity() == SIZE * 2);
+        assert(v[0] == 0 && v[1] == 42 && v[2] == 1);
+        assert(v[SIZE] == SIZE - 1);
+        v.Reserve(SIZE * 4);
+        assert(v[SIZE] == SIZE - 1);
+    }
+    {
+        Vector<std::unique_ptr<int>, MallocAllocator<std::unique_ptr<int>>> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.EmplaceBack(std::make_unique<int>(i));
+        }
+        // Аргумент ссылается на элемент, который переедет вместе с блоком
+        v.PushBack(std::move(v[0]));
+        assert(v[0] == nullptr);
+        assert(*v[1000] == 0);
+        assert(*v[999] == 999);
+    }
+}
+
+void TestAllocator_5() {
+    // 4M int = 16 МБ: блок берётся из mmap уже обнулённым, без прохода записи
+    const size_t SIZE = size_t{1} << 22;
+    {
+        Vector<int, MallocAllocator<int>> v(SIZE);
+        assert(v.Size() == SIZE && v.Capacity() == SIZE);
+        assert(v[0] == 0 && v[SIZE / 2] == 0 && v[SIZE - 1] == 0);
+        v[SIZE - 1] = 42;
+        v.Resize(SIZE * 2);
+        assert(v[SIZE - 1] == 42 && v[SIZE] == 0 && v[SIZE * 2 - 1] == 0);
+        v.Resize(10);
+        v[5] = 7;
+        v.Resize(20);
+        assert(v[5] == 7 && v[10] == 0 && v[19] == 0);
+    }
+    {
+        Vector<double, MallocAllocator<double>> v(100);
+        assert(v[99] == 0.0);
+        Vector<int *, MallocAllocator<int *>> pointers(100);
+        assert(pointers[99] == nullptr);
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "bit_vector.h"
+
+void TestBitVector_1() {
+    BitVector bits;
+    for (size_t i = 0; i < 200; ++i) {
+        bits.PushBack(i % 3 == 0);
+    }
+    assert(bits.Size() == 200 && bits.Capacity() == 256);
+    assert(bits.Count() == 67 && bits[0] && !bits[1] && bits[198]);
+    bits.Flip(1);
+    bits.Reset(0);
+    bits.Set(199);
+    assert(bits.Test(1) && !bits.Test(0) && bits.Count() == 68);
+
+    // Обход установленных битов через FindFirst/FindNext
+    size_t visited = 0;
+    for (size_t i = bits.FindFirst(); i != BitVector::kNpos; i = bits.FindNext(i)) {
+        assert(bits[i]);
+        ++visited;
+    }
+    assert(visited == 68);
+    assert(bits.FindFirst() == 1 && bits.FindNext(1) == 3 && bits.FindNext(199) == BitVector::kNpos);
+
+    // Биты за пределами размера не попадают в подсчёт
+    bits.Resize(70);
+    assert(bits.Count() == 24);
+    bits.Resize(130, true);
+    assert(bits.Count() == 84 && bits[69] && bits[70] && bits[129]);
+    bits.Resize(0);
+    assert(bits.FindFirst() == BitVector::kNpos && bits.Count() == 0);
+    bits.PushBack(true);
+    bits.PopBack();
+    bits.PushBack(false);
+    assert(bits.Size() == 1 && bits.Count() == 0);
+}
+
+void TestBitVector_2() {
+    const size_t SIZE = 1000;
+    BitVector even(SIZE);
+    BitVector small(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        even.Set(i, i % 2 == 0);
+        small.Set(i, i < 100);
+    }
+    assert((even & small).Count() == 50);
+    assert((even | small).Count() == 550);
+    assert((even ^ small).Count() == 500);
+    BitVector none = even;
+    none ^= even;
+    assert(none.Count() == 0 && none.FindFirst() == BitVector::kNpos && none != even);
+    none |= even;
+    assert(none == even);
+
+    const BitVector all(SIZE, true);
+    assert(all.Count() == SIZE && all.FindNext(SIZE - 2) == SIZE - 1);
+    BitVector copy(all);
+    copy &= small;
+    assert(copy == small);
+}
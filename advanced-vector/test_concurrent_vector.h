@@ -0,0 +1,63 @@
+#pragma once
+
+#include "concurrent_vector.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+void TestConcurrentVector_1() {
+    ConcurrentVector<std::string> v;
+    assert(v.Size() == 0 && !v.IsPublished(0));
+    const size_t first = v.PushBack(std::string(100, 'a'));
+    const std::string *address = &v[first];
+    for (int i = 0; i < 10'000; ++i) {
+        v.EmplaceBack(std::to_string(i));
+    }
+    // Рост не перемещает уже добавленные элементы
+    assert(&v[first] == address && v[first] == std::string(100, 'a'));
+    assert(v.Size() == 10'001 && v[10'000] == "9999");
+    assert(!v.IsPublished(10'001));
+}
+
+// Несколько писателей добавляют свои числа, читатель одновременно проверяет опубликованные элементы
+void TestConcurrentVector_2() {
+    const int THREADS = 4;
+    const int PER_THREAD = 20'000;
+    ConcurrentVector<std::unique_ptr<int>> v;
+    std::atomic<bool> done{false};
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            const size_t size = v.Size();
+            for (size_t i = 0; i < size; ++i) {
+                if (v.IsPublished(i)) {
+                    assert(*v[i] >= 0 && *v[i] < THREADS * PER_THREAD);
+                }
+            }
+        }
+    });
+    std::vector<std::thread> writers;
+    for (int t = 0; t < THREADS; ++t) {
+        writers.emplace_back([&v, t] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                const size_t index = v.EmplaceBack(std::make_unique<int>(t * PER_THREAD + i));
+                assert(*v[index] == t * PER_THREAD + i);
+            }
+        });
+    }
+    for (std::thread &writer: writers) {
+        writer.join();
+    }
+    done = true;
+    reader.join();
+
+    assert(v.Size() == static_cast<size_t>(THREADS * PER_THREAD));
+    std::vector<bool> seen(THREADS * PER_THREAD);
+    for (size_t i = 0; i < v.Size(); ++i) {
+        assert(v.IsPublished(i) && !seen[*v[i]]);
+        seen[*v[i]] = true;
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "eytzinger_index.h"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+
+void TestEytzingerIndex_1() {
+    // Все размеры до 70: полные и неполные последние уровни дерева
+    for (size_t n = 0; n <= 70; ++n) {
+        Vector<int> sorted;
+        for (size_t i = 0; i < n; ++i) {
+            sorted.PushBack(static_cast<int>(i / 2 * 10));
+        }
+        const EytzingerIndex<int> index(sorted);
+        assert(index.Size() == n);
+        for (int key = -5; key <= static_cast<int>(n * 5) + 5; ++key) {
+            const size_t expected = std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin();
+            assert(index.LowerBound(key) == expected);
+            assert(index.Contains(key) == std::binary_search(sorted.begin(), sorted.end(), key));
+        }
+    }
+
+    const std::string words[] = {"pear", "melon", "kiwi", "apple"};
+    const EytzingerIndex<std::string, std::greater<>> by_desc(std::begin(words), std::size(words));
+    assert(by_desc.LowerBound("lemon") == 2 && by_desc.Contains("kiwi") && !by_desc.Contains("fig"));
+}
+
+void TestEytzingerIndex_2() {
+    std::mt19937_64 random(7);
+    Vector<uint64_t> sorted;
+    for (size_t i = 0; i < 100'000; ++i) {
+        sorted.PushBack(random() % 1'000'000);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    // Мелкие куски, чтобы перестройка действительно делилась между потоками
+    const EytzingerIndex<uint64_t> index(sorted, ParallelPolicy{4, 1000});
+    assert(index.Size() == sorted.Size());
+    for (size_t i = 0; i < 10'000; ++i) {
+        const uint64_t key = random() % 1'100'000;
+        const size_t expected = std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin();
+        assert(index.LowerBound(key) == expected);
+    }
+    assert(index.LowerBound(sorted[0]) == 0 && index.Contains(sorted[sorted.Size() - 1]));
+}
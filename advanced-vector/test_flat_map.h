@@ -0,0 +1,125 @@
+#pragma once
+
+#include "flat_map.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+void TestFlatSet_1() {
+    FlatSet<int> set;
+    assert(set.Insert(5).second && set.Insert(1).second && !set.Insert(5).second);
+    const int keys[] = {9, 3, 5, 7, 3, 0};
+    set.InsertSorted(std::begin(keys), std::end(keys));
+    assert(set.Size() == 6 && std::is_sorted(set.begin(), set.end()));
+    assert(std::adjacent_find(set.begin(), set.end()) == set.end());
+    assert(set.Contains(7) && !set.Contains(4) && *set.LowerBound(4) == 5);
+    assert(set.Erase(3) == 1 && set.Erase(3) == 0 && set.Size() == 5);
+    assert(set.Find(100) == set.end() && set.LowerBound(100) == set.end());
+
+    FlatSet<std::string, std::greater<>> names;
+    const std::string more[] = {"b", "a", "c", "b"};
+    names.InsertSorted(std::begin(more), std::end(more));
+    assert(names.Size() == 3 && *names.begin() == "c");
+}
+
+template<bool Split>
+void TestFlatMap() {
+    FlatMap<int, std::string, std::less<int>, Split> map;
+    assert(map.TryEmplace(10, "ten").second);
+    assert(!map.TryEmplace(10, "TEN").second && *map.Find(10) == "ten");
+    map[5] = "five";
+    assert(map.InsertOrAssign(10, std::string("Ten")).first == 1 && map.ValueAt(1) == "Ten");
+
+    // Имеющийся ключ сохраняет значение, из повторов внутри пакета берётся первый
+    const std::pair<int, std::string> batch[] = {{7, "seven"}, {1, "one"}, {5, "FIVE"}, {7, "SEVEN"}, {20, "twenty"}};
+    map.InsertSorted(std::begin(batch), std::end(batch));
+    assert(map.Size() == 5);
+    assert(map.KeyAt(0) == 1 && map.KeyAt(4) == 20);
+    assert(*map.Find(5) == "five" && *map.Find(7) == "seven");
+    assert(map.Find(6) == nullptr && map.FindIndex(20) == 4 && map.FindIndex(21) == map.Size());
+
+    assert(map.Erase(7) == 1 && !map.Contains(7) && map.Size() == 4);
+    const auto &const_map = map;
+    assert(*const_map.Find(20) == "twenty");
+}
+
+template<bool Split>
+void TestFlatMapMoveOnly() {
+    // Значения только перемещаются: слияние забирает их из старого хранилища без копий
+    FlatMap<std::string, std::unique_ptr<int>, std::less<std::string>, Split> map;
+    map.TryEmplace("b", std::make_unique<int>(2));
+    std::pair<std::string, std::unique_ptr<int>> batch[] = {{"c", std::make_unique<int>(3)},
+                                                            {"a", std::make_unique<int>(1)},
+                                                            {"b", std::make_unique<int>(20)}};
+    map.InsertSorted(std::make_move_iterator(std::begin(batch)), std::make_move_iterator(std::end(batch)));
+    assert(map.Size() == 3 && map.KeyAt(0) == "a" && map.KeyAt(2) == "c");
+    assert(**map.Find("a") == 1 && **map.Find("b") == 2 && **map.Find("c") == 3);
+}
+
+// Сравнение строк, которое бросает исключение, когда заканчивается запас вызовов
+struct ThrowingLess {
+    bool operator()(const std::string &lhs, const std::string &rhs) const {
+        if (--*calls_left == 0) {
+            throw std::runtime_error("compare");
+        }
+        return lhs < rhs;
+    }
+
+    int *calls_left;
+};
+
+// Исключение из сравнения на любом шаге InsertSorted оставляет контейнер прежним
+template<bool Split>
+void TestFlatMapThrowingCompare() {
+    const std::string keys[] = {"f", "b", "d", "a", "e"};
+    const std::pair<std::string, std::string> items[] = {{"f", "6"}, {"b", "2"}, {"d", "4"}, {"a", "1"}};
+    for (int budget = 1; budget < 100; ++budget) {
+        int calls_left = 1'000;
+        FlatSet<std::string, ThrowingLess> set(ThrowingLess{&calls_left});
+        FlatMap<std::string, std::string, ThrowingLess, Split> map(ThrowingLess{&calls_left});
+        for (const char *key: {"a", "c", "e"}) {
+            set.Insert(key);
+            map.TryEmplace(key, key);
+        }
+        calls_left = budget;
+        try {
+            set.InsertSorted(std::begin(keys), std::end(keys));
+            assert(set.Size() == 6);
+        } catch (const std::runtime_error &) {
+            assert(set.Size() == 3 && *set.begin() == "a" && *(set.begin() + 1) == "c" && *(set.begin() + 2) == "e");
+        }
+        calls_left = budget;
+        try {
+            map.InsertSorted(std::begin(items), std::end(items));
+            assert(map.Size() == 6);
+        } catch (const std::runtime_error &) {
+            assert(map.Size() == 3);
+            for (size_t i = 0; i < 3; ++i) {
+                assert(map.KeyAt(i) == std::string(1, static_cast<char>('a' + 2 * i)) && map.ValueAt(i) == map.KeyAt(i));
+            }
+        }
+    }
+}
+
+void TestFlatMap_1() {
+    TestFlatMap<false>();
+    TestFlatMap<true>();
+    TestFlatMapMoveOnly<false>();
+    TestFlatMapMoveOnly<true>();
+    TestFlatMapThrowingCompare<false>();
+    TestFlatMapThrowingCompare<true>();
+
+    // Ключи только перемещаются: имеющиеся ключи переносятся в новое хранилище без копий
+    const auto by_value = [](const std::unique_ptr<int> &lhs, const std::unique_ptr<int> &rhs) {
+        return *lhs < *rhs;
+    };
+    FlatSet<std::unique_ptr<int>, decltype(by_value)> owners(by_value);
+    owners.Insert(std::make_unique<int>(5));
+    std::unique_ptr<int> more[] = {std::make_unique<int>(9), std::make_unique<int>(1), std::make_unique<int>(5)};
+    owners.InsertSorted(std::make_move_iterator(std::begin(more)), std::make_move_iterator(std::end(more)));
+    assert(owners.Size() == 3 && **owners.begin() == 1 && **(owners.end() - 1) == 9);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "gap_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+void TestGapBuffer_1() {
+    GapBuffer<char> text;
+    for (const char c: std::string("hello world")) {
+        text.PushBack(c);
+    }
+    // Правки у одного места переносят только промежуток
+    auto pos = text.Insert(text.cbegin() + 5, ',');
+    text.Insert(pos + 1, '!');
+    assert(text.Cursor() == 7 && text.Size() == 13);
+    text.Erase(text.cbegin() + 6);
+    text.Erase(text.cbegin() + 11, text.cend());
+    assert(std::string(text.begin(), text.end()) == "hello, worl");
+    text.Insert(text.cbegin(), '>');
+    assert(text.Cursor() == 1 && text[0] == '>' && text[11] == 'l');
+
+    const char *data = text.Compact();
+    assert(std::string(data, text.Size()) == ">hello, worl");
+    assert(text.Cursor() == text.Size());
+    text.Reserve(100);
+    assert(text.Capacity() == 100 && text[5] == 'o');
+    text.PopBack();
+    assert(text.Size() == 11 && text[10] == 'r');
+}
+
+void TestGapBuffer_2() {
+    GapBuffer<std::string> lines;
+    for (int i = 0; i < 10; ++i) {
+        lines.EmplaceBack(std::to_string(i));
+    }
+    lines.Insert(lines.cbegin() + 2, std::string("two"));
+    // Аргумент ссылается на элемент, который переедет при переносе промежутка
+    lines.Insert(lines.cbegin() + 9, lines[3]);
+    lines.Insert(lines.cbegin(), lines[9]);
+    assert(lines.Size() == 13);
+    assert(lines[0] == "2" && lines[3] == "two" && lines[10] == "2" && lines[12] == "9");
+
+    GapBuffer<std::string> copy(lines);
+    assert(std::equal(copy.begin(), copy.end(), lines.begin()));
+    lines.Erase(lines.cbegin() + 1, lines.cbegin() + 12);
+    assert(lines.Size() == 2 && lines[0] == "2" && lines[1] == "9");
+    copy = lines;
+    assert(copy.Size() == 2 && copy[1] == "9");
+    const auto it = std::find(copy.cbegin(), copy.cend(), "9");
+    assert(it - copy.cbegin() == 1);
+}
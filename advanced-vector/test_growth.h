@@ -0,0 +1,202 @@
+#pragma once
+
+#include "vector.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    // Тип с подсчётом перемещений, явно объявленный тривиально перемещаемым
+    struct RelocatableObj {
+        explicit RelocatableObj(int id)
+                : id(id) {
+        }
+
+        RelocatableObj(const RelocatableObj &other)
+                : id(other.id) {
+            ++num_copied;
+        }
+
+        RelocatableObj(RelocatableObj &&other) noexcept
+                : id(other.id) {
+            ++num_moved;
+        }
+
+        RelocatableObj &operator=(const RelocatableObj &other) = default;
+        RelocatableObj &operator=(RelocatableObj &&other) = default;
+
+        ~RelocatableObj() {
+            ++num_destroyed;
+        }
+
+        static void ResetCounters() {
+            num_copied = 0;
+            num_moved = 0;
+            num_destroyed = 0;
+        }
+
+        int id = 0;
+
+        static inline int num_copied = 0;
+        static inline int num_moved = 0;
+        static inline int num_destroyed = 0;
+    };
+
+}  // namespace
+
+template<>
+struct is_trivially_relocatable<RelocatableObj> : std::true_type {
+};
+
+void TestRelocation_1() {
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<std::pair<int64_t, double>>);
+    static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+    static_assert(!is_trivially_relocatable_v<std::string>);
+    const int SIZE = 1024;
+    {
+        RelocatableObj::ResetCounters();
+        Vector<RelocatableObj> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(i);
+        }
+        assert(v.Size() == v.Capacity());
+        v.Emplace(v.cbegin() + SIZE / 2, -1);
+        RelocatableObj obj{-2};
+        v.PushBack(obj);
+        v.Reserve(SIZE * 4);
+        // Рост буфера переносит элементы memcpy, без конструкторов и деструкторов
+        assert(RelocatableObj::num_moved == 0);
+        assert(RelocatableObj::num_destroyed == 0);
+        assert(RelocatableObj::num_copied == 1);
+        assert(v.Size() == SIZE + 2);
+        assert(v[SIZE / 2].id == -1);
+        assert(v[SIZE / 2 + 1].id == SIZE / 2);
+        assert(v[SIZE + 1].id == -2);
+    }
+    {
+        Vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.PushBack(std::make_unique<int>(i));
+        }
+        v.Emplace(v.cbegin(), std::make_unique<int>(-1));
+        assert(*v[0] == -1);
+        assert(*v[SIZE] == SIZE - 1);
+    }
+    {
+        Vector<std::pair<int64_t, double>> v;
+        for (int i = 0; i < SIZE; ++i) {
+            v.EmplaceBack(i, i * 0.5);
+        }
+        assert(v[SIZE - 1].first == SIZE - 1);
+        assert(v[SIZE - 1].second == (SIZE - 1) * 0.5);
+    }
+}
+
+namespace {
+
+    // Последовательность вместимостей при добавлении count элементов по одному
+    template<typename T, typename Policy>
+    std::vector<size_t> CapacityHistory(size_t count) {
+        Vector<T, std::allocator<T>, Policy> v;
+        std::vector<size_t> history;
+        for (size_t i = 0; i < count; ++i) {
+            v.EmplaceBack();
+            if (history.empty() || history.back() != v.Capacity()) {
+                history.push_back(v.Capacity());
+            }
+        }
+        return history;
+    }
+
+}  // namespace
+
+void TestGrowthPolicy_1() {
+    assert((CapacityHistory<int, DoublingGrowth>(9) == std::vector<size_t>{1, 2, 4, 8, 16}));
+    assert((CapacityHistory<int, OneAndHalfGrowth>(10) == std::vector<size_t>{1, 2, 3, 4, 6, 9, 13}));
+    assert((CapacityHistory<int, CacheLineGrowth<>>(20) == std::vector<size_t>{16, 32}));
+    assert((CapacityHistory<double, CacheLineGrowth<OneAndHalfGrowth>>(9) == std::vector<size_t>{8, 12}));
+    assert((CapacityHistory<int, PageRoundedGrowth<>>(1500) == std::vector<size_t>{1024, 2048}));
+    assert((CapacityHistory<char, HugePageRoundedGrowth>(1) == std::vector<size_t>{size_t{2} << 20}));
+    {
+        // Политика применяется и при вставке в середину
+        Vector<int, std::allocator<int>, CacheLineGrowth<>> v;
+        v.Emplace(v.cbegin(), 1);
+        assert(v.Capacity() == 16);
+        for (int i = 0; i < 15; ++i) {
+            v.Emplace(v.cbegin(), 0);
+        }
+        v.Emplace(v.cbegin() + 8, 2);
+        assert(v.Capacity() == 32);
+        assert(v[8] == 2 && v[16] == 1);
+    }
+}
+
+void TestShrink_1() {
+    {
+        Vector<std::string> v;
+        v.Reserve(100);
+        v.PushBack("a");
+        v.PushBack("b");
+        v.ShrinkToFit();
+        assert(v.Capacity() == 2 && v[1] == "b");
+        v.Resize(0);
+        v.ShrinkToFit();
+        assert(v.Capacity() == 0 && v.begin() == nullptr);
+        // Без AutoShrink вместимость не уменьшается сама
+        v.Resize(64);
+        v.Resize(1);
+        assert(v.Capacity() == 64);
+    }
+    {
+        Vector<int, std::allocator<int>, AutoShrink<>> v;
+        for (int i = 0; i < 64; ++i) {
+            v.PushBack(i);
+        }
+        assert(v.Capacity() == 64);
+        // Уменьшение только ниже четверти вместимости и сразу до удвоенного размера
+        while (v.Size() > 16) {
+            v.PopBack();
+        }
+        assert(v.Capacity() == 64);
+        v.PopBack();
+        assert(v.Size() == 15 && v.Capacity() == 30);
+        assert(v[14] == 14);
+        // Гистерезис: рост и удаление рядом с порогом не вызывают реаллокаций
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+            v.PopBack();
+        }
+        assert(v.Capacity() == 30);
+        // Вместимость не опускается ниже MinCapacity = 16
+        v.Erase(v.cbegin(), v.cbegin() + 10);
+        assert(v.Size() == 5 && v.Capacity() == 16);
+        auto pos = v.Erase(v.cbegin() + 1);
+        pos = v.Erase(pos);
+        assert(v.Size() == 3 && v.Capacity() == 16);
+        assert(*pos == 13 && v[0] == 10);
+        v.Resize(0);
+        assert(v.Capacity() == 16);
+        // У пустой границы блок сохраняется: добавление и удаление не выделяют память заново
+        const int *data = v.begin();
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+            v.PopBack();
+            assert(v.Size() == 0 && v.Capacity() == 16 && v.begin() == data);
+        }
+    }
+    {
+        Vector<uint64_t, MallocAllocator<uint64_t>, AutoShrink<DoublingGrowth, 8, 2>> v;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            v.PushBack(i);
+        }
+        assert(EraseIf(v, [](uint64_t x) {
+            return x >= 100;
+        }) == 900);
+        assert(v.Size() == 100 && v.Capacity() == 200 && v[99] == 99);
+    }
+}
@@ -0,0 +1,305 @@
+#pragma once
+
+#include "vector.h"
+#include "test9.h"
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+void TestOverwrite_1() {
+    using namespace std::literals;
+    {
+        Vector<char> v(1024, kDefaultInit);
+        assert(v.Size() == 1024 && v.Capacity() == 1024);
+        std::memset(v.begin(), 'a', v.Size());
+        v.ResizeForOverwrite(2048);
+        assert(v.Size() == 2048 && v[1023] == 'a');
+        v.ResizeForOverwrite(10);
+        assert(v.Size() == 10 && v.Capacity() == 2048);
+
+        const char text[] = "payload";
+        char *tail = v.AppendUninitialized(sizeof(text));
+        assert(tail == &v[10]);
+        std::memcpy(tail, text, sizeof(text));
+        assert(v.Size() == 10 + sizeof(text));
+        assert(std::strcmp(&v[10], "payload") == 0);
+    }
+    {
+        Vector<int> v;
+        v.AppendUninitialized(3);
+        assert(v.Capacity() == 3);
+        // Рост по политике роста, а не ровно под запрошенный размер
+        v.AppendUninitialized(1);
+        assert(v.Size() == 4 && v.Capacity() == 6);
+    }
+    {
+        // Классы инициализируются конструктором по умолчанию
+        Vector<std::string> v(2, kDefaultInit);
+        v.ResizeForOverwrite(4);
+        std::string *tail = v.AppendUninitialized(2);
+        assert(v.Size() == 6 && tail->empty() && v[3].empty());
+    }
+}
+
+void TestRangeInsert_1() {
+    using namespace std::literals;
+    {
+        Vector<int> v;
+        v.Insert(v.cbegin(), {1, 2, 6});
+        const int mid[] = {3, 4, 5};
+        auto pos = v.Insert(v.cbegin() + 2, std::begin(mid), std::end(mid));
+        assert(pos == v.begin() + 2);
+        assert(v.Size() == 6);
+        for (int i = 0; i < 6; ++i) {
+            assert(v[i] == i + 1);
+        }
+        v.Insert(v.cbegin(), 2, v[5]);
+        assert(v.Size() == 8 && v[0] == 6 && v[1] == 6 && v[2] == 1);
+        const std::vector<int> tail{7, 8};
+        v.AppendRange(tail.begin(), tail.end());
+        assert(v.Size() == 10 && v[9] == 8);
+        v.Insert(v.cend(), size_t{0}, 0);
+        assert(v.Size() == 10);
+    }
+    {
+        // Вставка в пределах вместимости: без реаллокации, хвост сдвигается один раз
+        Obj9::ResetCounters();
+        Vector<Obj9> v(10);
+        v.Reserve(20);
+        const Obj9 *data = &v[0];
+        std::vector<Obj9> chunk(3);
+        const int moved = Obj9::num_moved;
+        v.Insert(v.cbegin() + 5, chunk.begin(), chunk.end());
+        assert(&v[0] == data && v.Size() == 13);
+        assert(Obj9::num_moved - moved == 3);
+        assert(Obj9::num_move_assigned == 2);
+        assert(Obj9::num_assigned == 3 && Obj9::num_copied == 0);
+        std::vector<Obj9> big_chunk(6);
+        v.Insert(v.cbegin() + 10, big_chunk.begin(), big_chunk.end());
+        assert(v.Size() == 19 && &v[0] == data);
+    }
+    {
+        // Реаллокация ровно одна, даже если вставляется много элементов
+        Vector<std::string> v(4);
+        v[3] = "last"s;
+        std::vector<std::string> chunk(100, "x"s);
+        v.Insert(v.cbegin() + 1, chunk.begin(), chunk.end());
+        assert(v.Size() == 104 && v.Capacity() == 104);
+        assert(v[1] == "x"s && v[103] == "last"s);
+        v.Insert(v.cbegin() + 2, 3, v[103]);
+        assert(v[2] == "last"s && v[4] == "last"s && v[5] == "x"s);
+    }
+    {
+        // Значение из самого вектора при вставке в пределах вместимости: хвост сдвигается поверх
+        // него, поэтому вставляется его копия, снятая до сдвига
+        Vector<std::string> v;
+        for (const char *s: {"a", "b", "c", "d", "e"}) {
+            v.PushBack(s);
+        }
+        v.Reserve(20);
+        const std::string *data = &v[0];
+        v.Insert(v.cbegin(), 3, v[4]);
+        assert(&v[0] == data && v.Size() == 8);
+        assert(v[0] == "e"s && v[1] == "e"s && v[2] == "e"s);
+        assert(v[3] == "a"s && v[6] == "d"s && v[7] == "e"s);
+    }
+    {
+        std::istringstream input("3 4 5");
+        Vector<int> v;
+        v.Insert(v.cend(), {1, 2, 6});
+        v.Insert(v.cbegin() + 2, std::istream_iterator<int>(input), std::istream_iterator<int>());
+        assert(v.Size() == 6 && v[2] == 3 && v[4] == 5 && v[5] == 6);
+    }
+}
+
+void TestRangeErase_1() {
+    using namespace std::literals;
+    {
+        Vector<int> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(i);
+        }
+        auto pos = v.Erase(v.cbegin() + 2, v.cbegin() + 5);
+        assert(pos == v.begin() + 2 && *pos == 5);
+        assert(v.Size() == 7 && v[6] == 9);
+        assert(v.Erase(v.cbegin(), v.cbegin()) == v.begin());
+        assert(EraseIf(v, [](int x) {
+            return x % 2 == 1;
+        }) == 4);
+        assert(v.Size() == 3 && v[0] == 0 && v[1] == 6 && v[2] == 8);
+        v.Erase(v.cbegin(), v.cend());
+        assert(v.Size() == 0 && v.Capacity() == 16);
+    }
+    {
+        // Тривиально перемещаемые элементы с деструктором: удалённые уничтожены, остальные целы
+        Vector<std::unique_ptr<int>> v;
+        for (int i = 0; i < 10; ++i) {
+            v.PushBack(std::make_unique<int>(i));
+        }
+        v.Erase(v.cbegin() + 1, v.cbegin() + 3);
+        assert(v.Size() == 8 && *v[1] == 3);
+        assert(EraseIf(v, [](const std::unique_ptr<int> &p) {
+            return *p >= 5;
+        }) == 5);
+        assert(v.Size() == 3 && *v[2] == 4);
+    }
+    {
+        Obj9::ResetCounters();
+        Vector<Obj9> v(10);
+        for (int i = 0; i < 10; ++i) {
+            v[i].id = i;
+        }
+        v.Erase(v.cbegin() + 2, v.cbegin() + 4);
+        assert(Obj9::num_move_assigned == 6);
+        assert(Obj9::num_destroyed == 2);
+        assert(v[2].id == 4);
+        assert(EraseIf(v, [](const Obj9 &obj) {
+            return obj.id < 5;
+        }) == 3);
+        assert(v.Size() == 5 && v[0].id == 5 && v[4].id == 9);
+        assert(Obj9::GetAliveObjectCount() == 5);
+    }
+    {
+        // Исключение в предикате оставляет вектор целым
+        Vector<std::unique_ptr<int>> ptrs;
+        for (int i = 0; i < 6; ++i) {
+            ptrs.PushBack(std::make_unique<int>(i));
+        }
+        try {
+            EraseIf(ptrs, [](const std::unique_ptr<int> &p) {
+                if (*p == 4) {
+                    throw std::runtime_error("Oops");
+                }
+                return *p % 2 == 0;
+            });
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+        assert(ptrs.Size() == 4);
+        assert(*ptrs[0] == 1 && *ptrs[1] == 3 && *ptrs[2] == 4 && *ptrs[3] == 5);
+    }
+}
+
+void TestUnorderedErase_1() {
+    {
+        Vector<int> v;
+        for (int i = 0; i < 5; ++i) {
+            v.PushBack(i);
+        }
+        auto pos = v.EraseUnordered(v.cbegin() + 1);
+        assert(*pos == 4 && v.Size() == 4);
+        pos = v.EraseUnordered(v.cbegin() + 3);
+        assert(pos == v.end() && v.Size() == 3);
+        assert(v[0] == 0 && v[1] == 4 && v[2] == 2);
+    }
+    {
+        Obj9::ResetCounters();
+        Vector<Obj9> v(10);
+        for (int i = 0; i < 10; ++i) {
+            v[i].id = i;
+        }
+        v.EraseUnordered(v.cbegin());
+        assert(Obj9::num_move_assigned == 1 && v[0].id == 9);
+        Obj9::ResetCounters();
+        // Остались 9 1 2 3 4 5 6 7 8, удаляем чётные
+        const size_t removed = v.EraseUnorderedIf([](const Obj9 &obj) {
+            return obj.id % 2 == 0;
+        });
+        assert(removed == 4 && v.Size() == 5);
+        assert(Obj9::num_move_assigned <= 4);
+        assert(Obj9::num_destroyed == 4);
+        int sum = 0;
+        for (const Obj9 &obj: v) {
+            assert(obj.id % 2 == 1);
+            sum += obj.id;
+        }
+        assert(sum == 1 + 3 + 5 + 7 + 9);
+        assert(v.EraseUnorderedIf([](const Obj9 &) {
+            return true;
+        }) == 5);
+        assert(v.Size() == 0);
+    }
+}
+
+void TestEmplaceInPlace_1() {
+    using namespace std::literals;
+    const size_t SIZE = 10;
+    const int ID = 42;
+    {
+        // Самодостаточные аргументы: элемент строится прямо в ячейке, временного объекта нет
+        Obj9::ResetCounters();
+        Vector<Obj9> v(SIZE);
+        v.Reserve(SIZE * 2);
+        const int old_num_moved = Obj9::num_moved;
+        const int old_num_destroyed = Obj9::num_destroyed;
+        auto *pos = v.Emplace(v.cbegin() + 3, ID);
+        assert(pos->id == ID && v.Size() == SIZE + 1);
+        assert(Obj9::num_constructed_with_id == 1);
+        assert(Obj9::num_moved == old_num_moved + 1);
+        assert(Obj9::num_move_assigned == SIZE - 4);
+        // Уничтожена только освобождённая ячейка, а не временный объект
+        assert(Obj9::num_destroyed == old_num_destroyed + 1);
+    }
+    {
+        // Тот же вызов с аргументом из самого вектора идёт через временный объект:
+        // на одно перемещающее присваивание больше
+        Obj9::ResetCounters();
+        Vector<Obj9> v(SIZE);
+        v.Reserve(SIZE * 2);
+        v[0].id = ID;
+        const int old_num_moved = Obj9::num_moved;
+        const int old_num_destroyed = Obj9::num_destroyed;
+        v.Emplace(v.cbegin() + 3, v[0].id);
+        assert(v[3].id == ID);
+        assert(Obj9::num_moved == old_num_moved + 1);
+        assert(Obj9::num_move_assigned == SIZE - 3);
+        assert(Obj9::num_destroyed == old_num_destroyed + 1);
+    }
+    {
+        // Аргумент лежит внутри элемента вектора: используется безопасный путь
+        Vector<Obj9> v(SIZE);
+        v.Reserve(SIZE * 2);
+        v[3].id = ID;
+        v.Emplace(v.cbegin() + 3, v[3].id);
+        assert(v[3].id == ID && v[4].id == ID);
+        Vector<std::string> names(3);
+        names.Reserve(4);
+        names[0] = "Ivan"s;
+        names.Emplace(names.cbegin(), std::move(names[0]));
+        assert(names[0] == "Ivan"s);
+    }
+}
+
+void TestTrivialCopy_1() {
+    const size_t SIZE = 1000;
+    Vector<double> grid(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        grid[i] = static_cast<double>(i) / 4;
+    }
+    const Vector<double> snapshot(grid);
+    assert(snapshot.Size() == SIZE && snapshot[SIZE - 1] == grid[SIZE - 1]);
+
+    // Копирование в вектор с достаточной вместимостью не перевыделяет память
+    Vector<double> target(SIZE * 2);
+    const double *data = &target[0];
+    target = grid;
+    assert(&target[0] == data);
+    assert(target.Size() == SIZE && target.Capacity() == SIZE * 2);
+    assert(target[SIZE / 2] == grid[SIZE / 2]);
+
+    Vector<double> small(10);
+    small = grid;
+    assert(small.Size() == SIZE && small.Capacity() == SIZE);
+    assert(small[SIZE - 1] == grid[SIZE - 1]);
+
+    small = Vector<double>(3);
+    small = small;
+    assert(small.Size() == 3 && small[2] == 0.0);
+    small.Resize(1);
+    assert(small.Size() == 1);
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "vector.h"
+
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    // Создание объекта бросает исключение, когда счётчик copies_left доходит до нуля.
+    // Конструктора перемещения нет, поэтому Reserve переносит такие объекты копированием
+    struct FragileObj {
+        FragileObj() {
+            Acquire();
+        }
+
+        explicit FragileObj(int id)
+                : id(id) {
+            Acquire();
+        }
+
+        FragileObj(const FragileObj &other)
+                : id(other.id) {
+            Acquire();
+        }
+
+        FragileObj &operator=(const FragileObj &) = default;
+
+        ~FragileObj() {
+            --num_alive;
+        }
+
+        static void Acquire() {
+            if (copies_left.fetch_sub(1) == 0) {
+                throw std::runtime_error("copy failed");
+            }
+            ++num_alive;
+        }
+
+        int id = 0;
+
+        static inline std::atomic<int> num_alive{0};
+        static inline std::atomic<long> copies_left{std::numeric_limits<long>::max()};
+    };
+
+}  // namespace
+
+void TestParallel_1() {
+    const ParallelPolicy policy{4, 1000};
+    const size_t SIZE = 10'000;
+    {
+        const Vector<int> v(SIZE * 10, policy);
+        assert(v.Size() == SIZE * 10 && v[0] == 0 && v[SIZE * 10 - 1] == 0);
+
+        Vector<std::string> strings(SIZE, policy);
+        for (size_t i = 0; i < SIZE; ++i) {
+            strings[i] = std::to_string(i);
+        }
+        const Vector<std::string> copy(strings, policy);
+        assert(copy.Size() == SIZE && copy[SIZE - 1] == std::to_string(SIZE - 1));
+        strings.Reserve(SIZE * 3, policy);
+        assert(strings.Capacity() == SIZE * 3 && strings[1234] == "1234");
+        strings.Clear(policy);
+        assert(strings.Size() == 0 && strings.Capacity() == SIZE * 3);
+    }
+    {
+        Vector<FragileObj> v(SIZE, policy);
+        for (size_t i = 0; i < SIZE; ++i) {
+            v[i].id = static_cast<int>(i);
+        }
+        assert(FragileObj::num_alive == static_cast<int>(SIZE));
+
+        // Сбой в середине одного из кусков: созданные куски уничтожаются, исходный вектор цел
+        FragileObj::copies_left = SIZE / 2;
+        try {
+            Vector<FragileObj> copy(v, policy);
+            assert(false);
+        } catch (const std::runtime_error &) {
+        }
+        assert(FragileObj::num_alive == static_cast<int>(SIZE));
+
+        FragileObj::copies_left = SIZE - 10;
+        try {
+            v.Reserve(SIZE * 2, policy);
+            assert(false);
+        } catch (const std::runtime_error &) {
+        }
+        assert(v.Capacity() == SIZE && v[SIZE - 1].id == static_cast<int>(SIZE - 1));
+        assert(FragileObj::num_alive == static_cast<int>(SIZE));
+
+        FragileObj::copies_left = 100;
+        try {
+            Vector<FragileObj> w(SIZE, policy);
+            assert(false);
+        } catch (const std::runtime_error &) {
+        }
+        assert(FragileObj::num_alive == static_cast<int>(SIZE));
+
+        FragileObj::copies_left = std::numeric_limits<long>::max();
+        v.Reserve(SIZE * 2, policy);
+        assert(v.Capacity() == SIZE * 2 && v[SIZE - 1].id == static_cast<int>(SIZE - 1));
+        assert(FragileObj::num_alive == static_cast<int>(SIZE));
+        v.Clear(policy);
+        assert(FragileObj::num_alive == 0);
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ring_vector.h"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+
+void TestRingVector_1() {
+    RingVector<std::string> ring;
+    for (int i = 0; i < 8; ++i) {
+        ring.PushBack(std::to_string(i));
+    }
+    assert(ring.Size() == 8 && ring.Capacity() == 8);
+    // Очередь: кольцо сдвигается по буферу без роста
+    for (int i = 8; i < 100; ++i) {
+        assert(ring.Front() == std::to_string(i - 8));
+        ring.PopFront();
+        ring.PushBack(std::to_string(i));
+    }
+    assert(ring.Size() == 8 && ring.Capacity() == 8);
+    assert(ring.Front() == "92" && ring.Back() == "99" && ring[3] == "95");
+
+    // Рост разворачивает кольцо; аргумент ссылается на элемент самого кольца
+    ring.PushBack(ring[0]);
+    assert(ring.Size() == 9 && ring.Capacity() == 16 && ring.Back() == "92" && ring[7] == "99");
+    ring.PushFront("front");
+    ring.PopBack();
+    assert(ring.Front() == "front" && ring[1] == "92" && ring.Back() == "99");
+
+    const RingVector<std::string> copy(ring);
+    assert(copy.Size() == 9 && copy.Capacity() == 16);
+    assert(std::equal(copy.begin(), copy.end(), ring.begin()));
+}
+
+void TestRingVector_2() {
+    RingVector<int> ring;
+    // PushFront в полное кольцо: новый элемент встаёт в последнюю ячейку нового буфера
+    for (int i = 0; i < 20; ++i) {
+        ring.PushFront(i);
+    }
+    assert(ring.Size() == 20 && ring.Capacity() == 32);
+    assert(ring.Front() == 19 && ring.Back() == 0);
+    assert(std::is_sorted(ring.begin(), ring.end(), std::greater<>()));
+
+    int *data = ring.Linearize();
+    assert(data[0] == 19 && data[19] == 0 && &ring[0] == data);
+    // Непрерывное кольцо не переносится повторно
+    assert(ring.Linearize() == data);
+
+    ring.Reserve(100);
+    assert(ring.Capacity() == 128 && ring[5] == 14);
+    while (!ring.IsEmpty()) {
+        ring.PopBack();
+    }
+
+    RingVector<std::unique_ptr<int>> owners;
+    for (int i = 0; i < 5; ++i) {
+        owners.EmplaceBack(std::make_unique<int>(i));
+        owners.EmplaceFront(std::make_unique<int>(-i));
+    }
+    assert(*owners.Front() == -4 && *owners.Back() == 4 && owners.Size() == 10);
+    RingVector<std::unique_ptr<int>> moved(std::move(owners));
+    assert(owners.Size() == 0 && *moved[5] == 0);
+}
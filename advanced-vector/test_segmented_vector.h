@@ -0,0 +1,53 @@
+#pragma once
+
+#include "segmented_vector.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+void TestSegmentedVector_1() {
+    using Vec = SegmentedVector<std::string, 4>;
+    static_assert(Vec::BlockSize() == 16);
+    {
+        Vec v;
+        v.PushBack("first");
+        const std::string *first = &v[0];
+        for (int i = 1; i < 100; ++i) {
+            v.EmplaceBack(std::to_string(i));
+        }
+        // Рост не перемещает элементы
+        assert(&v[0] == first && *first == "first");
+        assert(v.Size() == 100 && v.Capacity() == 112);
+        // Аргумент ссылается на элемент этого же вектора
+        while (v.Size() < 112) {
+            v.PushBack(v[0]);
+        }
+        v.PushBack(v[1]);
+        assert(v.Size() == 113 && v[112] == "1" && v[111] == "first");
+
+        Vec copy(v);
+        assert(copy.Size() == 113 && copy[50] == "50");
+        v.Resize(20);
+        v.ShrinkToFit();
+        assert(v.Size() == 20 && v.Capacity() == 32 && &v[0] == first);
+        copy = v;
+        assert(copy.Size() == 20 && copy[19] == "19");
+        v.PopBack();
+        Vec moved(std::move(v));
+        assert(moved.Size() == 19 && v.Size() == 0 && &moved[0] == first);
+    }
+    {
+        SegmentedVector<int, 3> v(100);
+        std::iota(v.begin(), v.end(), 0);
+        assert(v[99] == 99);
+        assert(v.end() - v.begin() == 100);
+        auto it = std::lower_bound(v.cbegin(), v.cend(), 42);
+        assert(*it == 42 && it - v.cbegin() == 42);
+        assert(it[8] == 50 && *(it - 2) == 40);
+        std::sort(v.begin(), v.end(), std::greater<>());
+        assert(v[0] == 99 && v[99] == 0);
+        SegmentedVector<int, 3>::const_iterator cit = v.begin();
+        assert(cit == v.cbegin() && cit < v.cend());
+    }
+}
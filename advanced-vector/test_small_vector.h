@@ -0,0 +1,103 @@
+#pragma once
+
+#include "small_vector.h"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    struct SmallObj {
+        SmallObj() {
+            ++num_alive;
+        }
+
+        explicit SmallObj(int id)
+                : id(id) {
+            ++num_alive;
+        }
+
+        SmallObj(const SmallObj &other)
+                : id(other.id) {
+            if (other.throw_on_copy) {
+                throw std::runtime_error("Oops");
+            }
+            ++num_alive;
+        }
+
+        SmallObj &operator=(const SmallObj &other) = default;
+
+        ~SmallObj() {
+            --num_alive;
+        }
+
+        int id = 0;
+        bool throw_on_copy = false;
+
+        static inline int num_alive = 0;
+    };
+
+}  // namespace
+
+void TestSmallVector_1() {
+    using namespace std::literals;
+    {
+        SmallVector<std::string, 4> v;
+        assert(v.IsInline() && v.Capacity() == 4);
+        for (int i = 0; i < 4; ++i) {
+            v.PushBack(std::to_string(i));
+        }
+        assert(v.IsInline());
+        v.EmplaceBack("4"s);
+        assert(!v.IsInline());
+        assert(v.Capacity() == 8 && v.Size() == 5);
+        v.Insert(v.cbegin() + 1, v[4]);
+        v.Emplace(v.cbegin(), 3, 'x');
+        assert(v[0] == "xxx"s && v[1] == "0"s && v[2] == "4"s && v[6] == "4"s);
+        v.Erase(v.cbegin());
+        assert(v.Size() == 6 && v[0] == "0"s);
+
+        // Буфер из кучи при перемещении не копируется
+        const std::string *data = &v[0];
+        SmallVector<std::string, 4> moved(std::move(v));
+        assert(&moved[0] == data);
+        assert(v.Size() == 0 && v.IsInline());
+
+        SmallVector<std::string, 4> copy;
+        copy = moved;
+        assert(copy.Size() == 6 && copy[4] == "3"s && copy[5] == "4"s);
+        copy.Resize(2);
+        assert(copy.Size() == 2 && copy.Capacity() == 6);
+    }
+    {
+        SmallVector<std::string, 4> a(2);
+        a[0] = "a"s;
+        SmallVector<std::string, 4> b;
+        b.PushBack("b"s);
+        a.Swap(b);
+        assert(a.Size() == 1 && a[0] == "b"s);
+        assert(b.Size() == 2 && b[0] == "a"s);
+        b = std::move(a);
+        assert(b.Size() == 1 && b[0] == "b"s && b.IsInline());
+    }
+}
+
+void TestSmallVector_2() {
+    SmallObj::num_alive = 0;
+    {
+        SmallVector<SmallObj, 2> v(2);
+        v[1].throw_on_copy = true;
+        // Копирование при переезде в кучу бросает, вектор остаётся прежним
+        try {
+            v.PushBack(SmallObj{7});
+            assert(false && "Exception is expected");
+        } catch (const std::runtime_error &) {
+        }
+        assert(v.Size() == 2 && v.IsInline());
+        assert(SmallObj::num_alive == 2);
+        v[1].throw_on_copy = false;
+        v.PushBack(SmallObj{7});
+        assert(v.Size() == 3 && !v.IsInline() && v[2].id == 7);
+    }
+    assert(SmallObj::num_alive == 0);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "soa_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+
+void TestSoAVector_1() {
+    SoAVector<int, std::string, double> v;
+    for (int i = 0; i < 100; ++i) {
+        v.EmplaceBack(i, std::to_string(i), i * 0.5);
+    }
+    assert(v.Size() == 100 && v.Capacity() == 128);
+    // Все столбцы выровнены по кэш-линии
+    assert(reinterpret_cast<std::uintptr_t>(v.Span<1>().Data()) % 64 == 0);
+    assert(reinterpret_cast<std::uintptr_t>(v.Span<2>().Data()) % 64 == 0);
+
+    const auto ints = v.Span<0>();
+    assert(std::accumulate(ints.begin(), ints.end(), 0) == 4950);
+    assert(v.Span<1>()[42] == "42" && v.Span<2>().Size() == 100);
+
+    auto [id, name, weight] = v[7];
+    assert(id == 7 && name == "7" && weight == 3.5);
+    name = "seven";
+    assert(v.Span<1>()[7] == "seven");
+
+    // Аргументы ссылаются на поля вектора, который при этом перевыделяется
+    while (v.Size() < v.Capacity()) {
+        v.EmplaceBack(0, "", 0.0);
+    }
+    v.EmplaceBack(std::get<0>(v[7]), std::get<1>(v[7]), std::get<2>(v[7]));
+    assert(v.Capacity() == 256 && std::get<1>(v[128]) == "seven");
+
+    auto it = v.Erase(v.begin() + 1);
+    assert(std::get<0>(*it) == 2 && v.Size() == 128 && v.Span<1>()[6] == "seven");
+
+    // Итератор строк работает со стандартными алгоритмами
+    const auto found = std::find_if(v.cbegin(), v.cend(), [](const auto &row) {
+        return std::get<1>(row) == "50";
+    });
+    assert(found - v.cbegin() == 49 && std::get<2>(*found) == 25.0);
+    assert(std::count_if(v.begin(), v.end(), [](const auto &row) {
+        return std::get<0>(row) == 0;
+    }) == 29);
+    std::transform(v.begin(), v.begin() + 2, v.begin() + 2, [](const auto &row) {
+        return std::tuple(std::get<0>(row) + 1000, std::get<1>(row), std::get<2>(row));
+    });
+    assert(std::get<0>(v[2]) == 1000 && std::get<1>(v[3]) == "2");
+
+    const SoAVector<int, std::string, double> copy(v);
+    v.Clear();
+    assert(copy.Size() == 128 && std::get<1>(copy[6]) == "seven" && v.Size() == 0);
+    SoAVector<int, std::string, double> moved(std::move(v));
+    moved = copy;
+    assert(moved.Size() == 128 && std::get<0>(moved[127]) == 7);
+}
+
+void TestSoAVector_2() {
+    SoAVector<std::unique_ptr<int>, char> v;
+    v.Reserve(3);
+    v.EmplaceBack(std::make_unique<int>(1), 'a');
+    v.EmplaceBack(nullptr, 'b');
+    v.EmplaceBack(std::make_unique<int>(3), 'c');
+    v.EmplaceBack(std::make_unique<int>(4), 'd');
+    assert(*std::get<0>(v[0]) == 1 && *std::get<0>(v[3]) == 4);
+    v.Erase(v.begin() + 1);
+    v.PopBack();
+    assert(v.Size() == 2 && *std::get<0>(v[1]) == 3 && v.Span<1>()[1] == 'c');
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "static_vector.h"
+
+#include <stdexcept>
+#include <string>
+
+void TestStaticVector_1() {
+    using namespace std::literals;
+    {
+        StaticVector<int, 4> v;
+        static_assert(StaticVector<int, 4>::Capacity() == 4);
+        assert(v.TryPushBack(1));
+        assert(v.TryEmplaceBack(2));
+        v.PushBack(4);
+        v.Insert(v.cbegin() + 2, 3);
+        assert(v.IsFull());
+        assert(!v.TryPushBack(5));
+        assert(!v.TryEmplaceBack(5));
+        try {
+            v.EmplaceBack(5);
+            assert(false && "Exception is expected");
+        } catch (const std::length_error &) {
+        }
+        assert(v.Size() == 4 && v[0] == 1 && v[2] == 3 && v[3] == 4);
+
+        // Тривиально копируемые элементы копируются memcpy занятой части
+        StaticVector<int, 4> copy(v);
+        copy.Erase(copy.cbegin());
+        assert(copy.Size() == 3 && copy[0] == 2);
+        copy = v;
+        assert(copy.Size() == 4 && copy[3] == 4);
+        StaticVector<int, 4> moved(std::move(copy));
+        assert(moved.Size() == 4 && copy.Size() == 0);
+    }
+    {
+        StaticVector<std::string, 3> v(2);
+        v[0] = "a"s;
+        v.Emplace(v.cbegin(), v[0]);
+        assert(v[0] == "a"s && v[1] == "a"s && v[2].empty());
+        try {
+            v.Resize(4);
+            assert(false && "Exception is expected");
+        } catch (const std::length_error &) {
+        }
+        v.Resize(1);
+        StaticVector<std::string, 3> other;
+        other.PushBack("b"s);
+        other.PushBack("c"s);
+        other = v;
+        assert(other.Size() == 1 && other[0] == "a"s);
+        v = std::move(other);
+        assert(v.Size() == 1 && other.Size() == 0);
+    }
+}
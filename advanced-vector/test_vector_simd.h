@@ -0,0 +1,154 @@
+#pragma once
+
+#include "vector_simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    template<typename T>
+    bool SameBits(const T &lhs, const T &rhs) {
+        return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    }
+
+    // Скалярный уровень сверяется со стандартными алгоритмами, а все уровни, которые поддерживает
+    // процессор, дают тот же результат, что и скалярный, бит в бит. Размеры покрывают хвосты
+    // любой длины
+    template<typename T>
+    void TestSimdLevels(std::mt19937_64 &random) {
+        std::uniform_int_distribution<int> small(-50, 50);
+        for (size_t n = 1; n <= 300; n += n < 70 ? 1 : 37) {
+            Vector<T> v;
+            for (size_t i = 0; i < n; ++i) {
+                v.PushBack(static_cast<T>(small(random)) / static_cast<T>(std::is_floating_point_v<T> ? 3 : 1));
+            }
+            const T present = v[n - 1];
+            const T absent = static_cast<T>(1000);
+            const auto sum = simd::Sum(v, simd::Level::kScalar);
+            const auto min_max = simd::MinMax(v, simd::Level::kScalar);
+            assert(min_max.first == *std::min_element(v.begin(), v.end()));
+            assert(min_max.second == *std::max_element(v.begin(), v.end()));
+            if constexpr (std::is_integral_v<T>) {
+                assert(sum == std::accumulate(v.begin(), v.end(), int64_t{0}));
+            } else {
+                assert(std::abs(sum - std::accumulate(v.begin(), v.end(), T{0})) < static_cast<T>(1e-3));
+            }
+
+            Vector<T> copy(v);
+            for (int level = 0; level <= static_cast<int>(simd::DetectLevel()); ++level) {
+                const auto l = static_cast<simd::Level>(level);
+                assert(simd::Find(v, present, l) == std::find(v.begin(), v.end(), present));
+                assert(simd::Find(v, absent, l) == v.end() && !simd::Contains(v, absent, l));
+                assert(simd::Count(v, present, l) == static_cast<size_t>(std::count(v.begin(), v.end(), present)));
+                assert(SameBits(simd::Sum(v, l), sum));
+                assert(SameBits(simd::MinMax(v, l).first, min_max.first));
+                assert(SameBits(simd::MinMax(v, l).second, min_max.second));
+                assert(simd::Equal(v, copy, l));
+                copy[n / 2] = absent;
+                assert(!simd::Equal(v, copy, l));
+                copy[n / 2] = v[n / 2];
+
+                Vector<T> filled(n);
+                simd::Fill(filled, present, l);
+                assert(simd::Count(filled, present, l) == n);
+            }
+        }
+    }
+
+    // EraseIf на каждом уровне оставляет то же, что std::remove_if
+    template<typename T, typename Pred>
+    void TestSimdEraseIf(const Vector<T> &values, const Pred &pred) {
+        Vector<T> expected(values);
+        expected.Erase(std::remove_if(expected.begin(), expected.end(), pred), expected.end());
+        for (int level = 0; level <= static_cast<int>(simd::DetectLevel()); ++level) {
+            Vector<T> v(values);
+            assert(simd::EraseIf(v, pred, static_cast<simd::Level>(level)) == values.Size() - expected.Size());
+            assert(v.Size() == expected.Size() && std::equal(v.begin(), v.end(), expected.begin()));
+        }
+    }
+}  // namespace
+
+void TestVectorSimd_1() {
+    std::mt19937_64 random(11);
+    TestSimdLevels<int32_t>(random);
+    TestSimdLevels<int64_t>(random);
+    TestSimdLevels<float>(random);
+    TestSimdLevels<double>(random);
+}
+
+void TestVectorSimd_2() {
+    const auto best = simd::DetectLevel();
+    // Сумма int32_t считается в int64_t и не переполняется
+    Vector<int32_t> big(1000);
+    simd::Fill(big, std::numeric_limits<int32_t>::max(), best);
+    assert(simd::Sum(big, best) == int64_t{1000} * std::numeric_limits<int32_t>::max());
+
+    // NaN пропускается в MinMax и не равен себе в Find, Count и Equal
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    Vector<double> values(100);
+    values[3] = nan;
+    values[50] = -2.5;
+    values[99] = 7.0;
+    const auto [min, max] = simd::MinMax(values, best);
+    assert(min == -2.5 && max == 7.0);
+    assert(!simd::Contains(values, nan, best) && simd::Count(values, 0.0, best) == 97);
+    assert(!simd::Equal(values, values, best));
+    assert(*simd::Find(values, 7.0, best) == 7.0);
+
+    Vector<double> only_nan(5);
+    simd::Fill(only_nan, nan, best);
+    assert(simd::MinMax(only_nan, best).first == std::numeric_limits<double>::infinity());
+
+    // Уровень выше поддерживаемого процессором понижается, а не выполняет недоступные инструкции
+    Vector<int32_t> ints(100);
+    simd::Fill(ints, 3, simd::Level::kAvx512);
+    ints[70] = 5;
+    assert(simd::Count(ints, 3, simd::Level::kAvx512) == 99 && simd::Sum(ints, simd::Level::kAvx512) == 302);
+    assert(simd::EraseIf(ints, simd::Less(4), simd::Level::kAvx512) == 99 && ints.Size() == 1);
+
+    // Вектора разного размера не равны
+    Vector<float> shorter(10);
+    Vector<float> longer(11);
+    assert(!simd::Equal(shorter, longer, best));
+}
+
+void TestVectorSimd_3() {
+    std::mt19937_64 random(5);
+    std::uniform_int_distribution<int32_t> small(-20, 20);
+    for (size_t n = 0; n <= 200; n += n < 40 ? 1 : 23) {
+        Vector<int32_t> ints;
+        Vector<float> floats;
+        for (size_t i = 0; i < n; ++i) {
+            ints.PushBack(small(random));
+            floats.PushBack(static_cast<float>(small(random)) / 4.0f);
+        }
+        TestSimdEraseIf(ints, simd::Less(0));
+        TestSimdEraseIf(ints, simd::Greater(-30));
+        TestSimdEraseIf(ints, simd::InRange(-5, 5));
+        TestSimdEraseIf(ints, simd::EqualsAny{1, -3, 7, 20});
+        TestSimdEraseIf(floats, simd::Less(1.5f));
+        TestSimdEraseIf(floats, simd::Greater(10.0f));
+        TestSimdEraseIf(floats, simd::InRange(-1.0f, 1.0f));
+        TestSimdEraseIf(floats, simd::EqualsAny{0.25f, -0.0f});
+    }
+
+    // Значений больше kMaxValues не помещается
+    bool thrown = false;
+    try {
+        simd::EqualsAny<int32_t>{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    } catch (const std::length_error &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // NaN не меньше и не больше порога, поэтому остаётся
+    Vector<float> with_nan(40);
+    with_nan[17] = std::numeric_limits<float>::quiet_NaN();
+    assert(simd::EraseIf(with_nan, simd::Less(1.0f)) == 39);
+    assert(with_nan.Size() == 1 && std::isnan(with_nan[0]));
+}
@@ -2,34 +2,343 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstddef>
+#include <cstring>
 #include <new>
 #include <utility>
 #include <memory>
 #include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
 
+#include "growth_policy.h"
+#include "malloc_allocator.h"
+#include "parallel.h"
+
+// Тип тривиально перемещаем, если объект можно перенести в другую память побайтовым копированием,
+// не вызывая конструктор перемещения и деструктор исходного объекта.
+// Для своих типов (например, с указателем на собственный ресурс) специализацию можно добавить явно
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {
+};
+
+template<typename T, typename D>
+struct is_trivially_relocatable<std::unique_ptr<T, D>> : is_trivially_relocatable<D> {
+};
+
+template<typename T1, typename T2>
+struct is_trivially_relocatable<std::pair<T1, T2>>
+        : std::conjunction<is_trivially_relocatable<T1>, is_trivially_relocatable<T2>> {
+};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Значение типа не ссылается на другие объекты, то есть через него нельзя добраться
+// до элементов вектора. Такие аргументы Emplace не требуют временного объекта
 template<typename T>
+struct is_self_contained
+        : std::bool_constant<std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_null_pointer_v<T>> {
+};
+
+template<typename CharT, typename Traits>
+struct is_self_contained<std::basic_string<CharT, Traits, std::allocator<CharT>>> : std::true_type {
+};
+
+template<typename T>
+inline constexpr bool is_self_contained_v = is_self_contained<T>::value;
+
+namespace detail {
+    // Уничтожает n объектов; для тривиально разрушаемых типов ничего не делает даже без оптимизации
+    template<typename T>
+    void DestroyN(T *first, size_t n) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            std::destroy_n(first, n);
+        }
+    }
+
+    // Копирует n элементов в неинициализированную память; тривиально копируемые одним memcpy
+    template<typename T>
+    void UninitializedCopyN(const T *src, size_t n, T *dst) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (n != 0) {
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(T));
+            }
+        } else {
+            std::uninitialized_copy_n(src, n, dst);
+        }
+    }
+
+    // Строгая гарантия при переносе: перемещаем, только если это не бросает исключений
+    // или если копировать всё равно нельзя
+    template<typename T>
+    inline constexpr bool kMoveOnRelocate = std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>;
+
+    // Конструирует в dst перемещённые или скопированные значения n элементов src, не уничтожая их
+    template<typename T>
+    void UninitializedTransferN(T *src, size_t n, T *dst) {
+        if constexpr (kMoveOnRelocate<T>) {
+            std::uninitialized_move_n(src, n, dst);
+        } else {
+            std::uninitialized_copy_n(src, n, dst);
+        }
+    }
+
+    // Переносит n элементов из src в неинициализированную память dst, оставляя после первых pos
+    // элементов пустой промежуток из gap ячеек. После переноса исходные объекты уничтожены,
+    // при исключении src остаётся нетронутым
+    template<typename T>
+    void RelocateWithGap(T *src, size_t n, size_t pos, size_t gap, T *dst) {
+        assert(pos <= n);
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (pos != 0) {
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), pos * sizeof(T));
+            }
+            if (n != pos) {
+                std::memcpy(static_cast<void *>(dst + pos + gap), static_cast<const void *>(src + pos),
+                            (n - pos) * sizeof(T));
+            }
+        } else {
+            UninitializedTransferN(src, pos, dst);
+            try {
+                UninitializedTransferN(src + pos, n - pos, dst + pos + gap);
+            } catch (...) {
+                DestroyN(dst, pos);
+                throw;
+            }
+            DestroyN(src, n);
+        }
+    }
+
+    // Переносит n элементов из src в неинициализированную память dst
+    template<typename T>
+    void RelocateN(T *src, size_t n, T *dst) {
+        RelocateWithGap(src, n, n, 0, dst);
+    }
+
+    // Параллельные варианты: каждый поток обрабатывает свой кусок, при исключении уже созданные
+    // куски уничтожаются (см. ParallelChunks)
+
+    template<typename T>
+    void DestroyN(T *first, size_t n, const ParallelPolicy &policy) noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            ParallelChunks(n, policy, [first](size_t begin, size_t count) noexcept {
+                std::destroy_n(first + begin, count);
+            });
+        }
+    }
+
+    template<typename T>
+    void UninitializedValueConstructN(T *first, size_t n, const ParallelPolicy &policy) {
+        ParallelChunks(n, policy, [first](size_t begin, size_t count) {
+            std::uninitialized_value_construct_n(first + begin, count);
+        }, [first](size_t begin, size_t count) noexcept {
+            DestroyN(first + begin, count);
+        });
+    }
+
+    template<typename T>
+    void UninitializedCopyN(const T *src, size_t n, T *dst, const ParallelPolicy &policy) {
+        ParallelChunks(n, policy, [src, dst](size_t begin, size_t count) {
+            UninitializedCopyN(src + begin, count, dst + begin);
+        }, [dst](size_t begin, size_t count) noexcept {
+            DestroyN(dst + begin, count);
+        });
+    }
+
+    // Исходные объекты уничтожаются только после того, как все куски успешно перенесены
+    template<typename T>
+    void RelocateN(T *src, size_t n, T *dst, const ParallelPolicy &policy) {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ParallelChunks(n, policy, [src, dst](size_t begin, size_t count) noexcept {
+                RelocateN(src + begin, count, dst + begin);
+            });
+        } else {
+            ParallelChunks(n, policy, [src, dst](size_t begin, size_t count) {
+                UninitializedTransferN(src + begin, count, dst + begin);
+            }, [dst](size_t begin, size_t count) noexcept {
+                DestroyN(dst + begin, count);
+            });
+            DestroyN(src, n, policy);
+        }
+    }
+
+    // Аллокатор умеет менять размер блока на месте: a.reallocate(p, old_n, new_n)
+    template<typename Allocator, typename = void>
+    struct HasReallocate : std::false_type {
+    };
+
+    template<typename Allocator>
+    struct HasReallocate<Allocator, std::void_t<decltype(std::declval<Allocator &>().reallocate(
+            std::declval<typename std::allocator_traits<Allocator>::pointer>(), size_t{}, size_t{}))>>
+            : std::true_type {
+    };
+
+    // Аллокатор умеет выделять обнулённую память: a.allocate_zeroed(n)
+    template<typename Allocator, typename = void>
+    struct HasAllocateZeroed : std::false_type {
+    };
+
+    template<typename Allocator>
+    struct HasAllocateZeroed<Allocator, std::void_t<decltype(std::declval<Allocator &>().allocate_zeroed(size_t{}))>>
+            : std::true_type {
+    };
+
+    // Инициализация значением даёт объект из одних нулевых байтов
+    template<typename T>
+    inline constexpr bool kZeroIsValueInit = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+    // Тег конструктора RawMemory, выделяющего обнулённую память
+    struct ZeroedTag {
+        explicit ZeroedTag() = default;
+    };
+
+    inline constexpr ZeroedTag kZeroed{};
+
+    // Политика роста умеет уменьшать вместимость: ShrinkCapacity(size, capacity, elem_size)
+    template<typename Policy, typename = void>
+    struct HasShrinkCapacity : std::false_type {
+    };
+
+    template<typename Policy>
+    struct HasShrinkCapacity<Policy, std::void_t<decltype(Policy::ShrinkCapacity(size_t{}, size_t{}, size_t{}))>>
+            : std::true_type {
+    };
+
+    template<typename It, typename = void>
+    struct IsInputIterator : std::false_type {
+    };
+
+    template<typename It>
+    struct IsInputIterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+            : std::is_convertible<typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag> {
+    };
+
+    template<typename It>
+    inline constexpr bool kIsForwardIterator = std::is_convertible_v<
+            typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>;
+
+    // Прямой итератор по count копиям одного значения, чтобы Insert(pos, count, value)
+    // шёл тем же путём, что и вставка диапазона
+    template<typename T>
+    class RepeatIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        RepeatIterator(const T &value, size_t index) noexcept
+                : value_(&value), index_(index) {
+        }
+
+        reference operator*() const noexcept {
+            return *value_;
+        }
+
+        pointer operator->() const noexcept {
+            return value_;
+        }
+
+        RepeatIterator &operator++() noexcept {
+            ++index_;
+            return *this;
+        }
+
+        RepeatIterator operator++(int) noexcept {
+            RepeatIterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        friend bool operator==(const RepeatIterator &lhs, const RepeatIterator &rhs) noexcept {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend bool operator!=(const RepeatIterator &lhs, const RepeatIterator &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+    private:
+        const T *value_;
+        size_t index_;
+    };
+
+    // Номер старшего установленного бита; value != 0
+    inline size_t HighestBit(size_t value) noexcept {
+        assert(value != 0);
+#if defined(__GNUC__)
+        static_assert(sizeof(size_t) <= sizeof(unsigned long long));
+        return sizeof(unsigned long long) * 8 - 1 - static_cast<size_t>(__builtin_clzll(value));
+#else
+        size_t bit = 0;
+        while (value >>= 1) {
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    // Хотя бы один из аргументов лежит в диапазоне [first, last). Адреса сравниваются через
+    // std::less, который задаёт полный порядок и для указателей на разные объекты
+    template<typename T, typename... Args>
+    bool AliasesRange([[maybe_unused]] const T *first, [[maybe_unused]] const T *last,
+                      const Args &... args) noexcept {
+        [[maybe_unused]] const std::less<const void *> less;
+        return ((!less(static_cast<const void *>(std::addressof(args)), first)
+                 && less(static_cast<const void *>(std::addressof(args)), last)) || ...);
+    }
+}  // namespace detail
+
+template<typename T, typename Allocator = std::allocator<T>>
 class RawMemory {
+    using AllocTraits = typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+
 public:
+    using allocator_type = typename AllocTraits::allocator_type;
+
     RawMemory() = default;
 
-    explicit RawMemory(size_t capacity)
-            : buffer_(Allocate(capacity)), capacity_(capacity) {
+    explicit RawMemory(const allocator_type &alloc) noexcept
+            : alloc_(alloc) {
+    }
+
+    explicit RawMemory(size_t capacity, const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), buffer_(Allocate(capacity)), capacity_(capacity) {
+    }
+
+    // Память заполнена нулями; аллокатор должен поддерживать allocate_zeroed
+    RawMemory(size_t capacity, detail::ZeroedTag, const allocator_type &alloc = allocator_type())
+            : alloc_(alloc), buffer_(AllocateZeroed(capacity)), capacity_(capacity) {
     }
 
     RawMemory(const RawMemory &) = delete;
 
     RawMemory &operator=(const RawMemory &rhs) = delete;
 
-    RawMemory(RawMemory &&other) noexcept {
-        this->Swap(other);
+    RawMemory(RawMemory &&other) noexcept
+            : alloc_(std::move(other.alloc_))
+            , buffer_(std::exchange(other.buffer_, nullptr))
+            , capacity_(std::exchange(other.capacity_, 0)) {
     }
 
+    // Забирает блок rhs. Блок можно освободить только тем аллокатором, которым он выделен,
+    // поэтому без propagate_on_container_move_assignment аллокаторы обязаны быть равны
     RawMemory &operator=(RawMemory &&rhs) noexcept {
         if (this != &rhs) {
-            this->Swap(rhs);
-            Deallocate(rhs.buffer_);
-            rhs.buffer_ = nullptr;
-            rhs.capacity_ = 0;
+            Deallocate(buffer_);
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                alloc_ = std::move(rhs.alloc_);
+            } else {
+                assert(alloc_ == rhs.alloc_);
+            }
+            buffer_ = std::exchange(rhs.buffer_, nullptr);
+            capacity_ = std::exchange(rhs.capacity_, 0);
         }
         return *this;
     }
@@ -57,11 +366,40 @@ public:
         return buffer_[index];
     }
 
+    // Аллокаторы обмениваются только при propagate_on_container_swap,
+    // иначе обмен блоками допустим лишь между равными аллокаторами
     void Swap(RawMemory &other) noexcept {
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        } else {
+            assert(alloc_ == other.alloc_);
+        }
         std::swap(buffer_, other.buffer_);
         std::swap(capacity_, other.capacity_);
     }
 
+    // Меняет вместимость блока, сохраняя его байты. Аллокатор может расширить блок на месте
+    // (realloc/mremap), поэтому годится только для тривиально перемещаемых T
+    void Reallocate(size_t new_capacity) {
+        static_assert(detail::HasReallocate<allocator_type>::value);
+        if (buffer_ == nullptr) {
+            buffer_ = Allocate(new_capacity);
+        } else {
+            buffer_ = alloc_.reallocate(buffer_, capacity_, new_capacity);
+        }
+        capacity_ = new_capacity;
+    }
+
+    // Освобождает блок и переходит на аллокатор alloc
+    // (нужно при propagate_on_container_copy_assignment)
+    void ResetAllocator(const allocator_type &alloc) {
+        Deallocate(buffer_);
+        buffer_ = nullptr;
+        capacity_ = 0;
+        alloc_ = alloc;
+    }
+
     const T *GetAddress() const noexcept {
         return buffer_;
     }
@@ -74,55 +412,147 @@ public:
         return capacity_;
     }
 
+    const allocator_type &GetAllocator() const noexcept {
+        return alloc_;
+    }
+
 private:
     // Выделяет сырую память под n элементов и возвращает указатель на неё
-    static T *Allocate(size_t n) {
-        return n != 0 ? static_cast<T *>(operator new(n * sizeof(T))) : nullptr;
+    T *Allocate(size_t n) {
+        return n != 0 ? AllocTraits::allocate(alloc_, n) : nullptr;
+    }
+
+    T *AllocateZeroed(size_t n) {
+        static_assert(detail::HasAllocateZeroed<allocator_type>::value);
+        return n != 0 ? alloc_.allocate_zeroed(n) : nullptr;
     }
 
     // Освобождает сырую память, выделенную ранее по адресу buf при помощи Allocate
-    static void Deallocate(T *buf) noexcept {
-        operator delete(buf);
+    void Deallocate(T *buf) noexcept {
+        if (buf != nullptr) {
+            AllocTraits::deallocate(alloc_, buf, capacity_);
+        }
     }
 
+    allocator_type alloc_ = allocator_type();
     T *buffer_ = nullptr;
     size_t capacity_ = 0;
 };
 
-template<typename T>
+// Тег конструктора Vector, создающего элементы инициализацией по умолчанию:
+// значения тривиальных типов остаются неопределёнными и память не заполняется нулями
+struct DefaultInitTag {
+    explicit DefaultInitTag() = default;
+};
+
+inline constexpr DefaultInitTag kDefaultInit{};
+
+template<typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = DoublingGrowth>
 class Vector {
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    // Рост без выделения нового блока: аллокатор расширяет старый (см. MallocAllocator)
+    static constexpr bool kGrowInPlace = is_trivially_relocatable_v<T> && detail::HasReallocate<Allocator>::value;
+
+    // Инициализация значением сводится к выделению обнулённой памяти (calloc, mmap)
+    static constexpr bool kZeroedAllocation = detail::kZeroIsValueInit<T> && detail::HasAllocateZeroed<Allocator>::value;
+
 public:
     using iterator = T *;
     using const_iterator = const T *;
+    using allocator_type = Allocator;
+    using growth_policy = GrowthPolicy;
 
     Vector() = default;
 
-    explicit Vector(size_t size)
-            : data_(size), size_(size)  //
+    explicit Vector(const Allocator &alloc) noexcept
+            : data_(alloc) {
+    }
+
+    explicit Vector(size_t size, const Allocator &alloc = Allocator())
+            : data_(AllocateValueInitialized(size, alloc)), size_(size)  //
+    {
+        if constexpr (!kZeroedAllocation) {
+            std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        }
+    }
+
+    Vector(size_t size, DefaultInitTag, const Allocator &alloc = Allocator())
+            : data_(size, alloc), size_(size)  //
+    {
+        std::uninitialized_default_construct_n(data_.GetAddress(), size);
+    }
+
+    // Элементы создаются параллельно, каждый поток первым касается страниц своего куска
+    Vector(size_t size, const ParallelPolicy &policy, const Allocator &alloc = Allocator())
+            : data_(AllocateValueInitialized(size, alloc)), size_(size)  //
     {
-        std::uninitialized_value_construct_n(data_.GetAddress(), size);
+        if constexpr (!kZeroedAllocation) {
+            detail::UninitializedValueConstructN(data_.GetAddress(), size, policy);
+        }
     }
 
     Vector(const Vector &other)
-            : data_(other.size_), size_(other.size_)  //
+            : Vector(other, AllocTraits::select_on_container_copy_construction(other.GetAllocator())) {
+    }
+
+    Vector(const Vector &other, const ParallelPolicy &policy)
+            : data_(other.size_, AllocTraits::select_on_container_copy_construction(other.GetAllocator())),
+              size_(other.size_)  //
     {
-        std::uninitialized_copy_n(other.data_.GetAddress(), size_, data_.GetAddress());
+        detail::UninitializedCopyN(other.data_.GetAddress(), size_, data_.GetAddress(), policy);
     }
 
-    Vector(Vector &&other) noexcept {
-        this->Swap(other);
+    Vector(const Vector &other, const Allocator &alloc)
+            : data_(other.size_, alloc), size_(other.size_)  //
+    {
+        detail::UninitializedCopyN(other.data_.GetAddress(), size_, data_.GetAddress());
+    }
+
+    Vector(Vector &&other) noexcept
+            : data_(std::move(other.data_)), size_(std::exchange(other.size_, 0)) {
+    }
+
+    // При неравных аллокаторах буфер other забрать нельзя, элементы перемещаются поштучно
+    Vector(Vector &&other, const Allocator &alloc)
+            : data_(alloc) {
+        if (alloc == other.GetAllocator()) {
+            data_ = std::move(other.data_);
+            size_ = std::exchange(other.size_, 0);
+        } else {
+            RawMemory<T, Allocator> new_data(other.size_, alloc);
+            std::uninitialized_move_n(other.data_.GetAddress(), other.size_, new_data.GetAddress());
+            data_ = std::move(new_data);
+            size_ = other.size_;
+        }
     }
 
     Vector &operator=(const Vector &rhs) {
         if (this != &rhs) {
-            if (rhs.size_ > data_.Capacity()) {
+            if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+                if (GetAllocator() != rhs.GetAllocator()) {
+                    // Старый блок принадлежит старому аллокатору, освобождаем его до смены
+                    detail::DestroyN(data_.GetAddress(), size_);
+                    size_ = 0;
+                    data_.ResetAllocator(rhs.GetAllocator());
+                }
+            }
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                // Старые элементы не требуют уничтожения: при нехватке места просто берём новый блок
+                if (rhs.size_ > data_.Capacity()) {
+                    RawMemory<T, Allocator> new_data(rhs.size_, data_.GetAllocator());
+                    data_.Swap(new_data);
+                }
+                detail::UninitializedCopyN(rhs.data_.GetAddress(), rhs.size_, data_.GetAddress());
+                size_ = rhs.size_;
+            } else if (rhs.size_ > data_.Capacity()) {
                 /* Применить copy-and-swap */
-                Vector rhs_copy(rhs);
+                Vector rhs_copy(rhs, GetAllocator());
                 this->Swap(rhs_copy);
             } else {
                 if (rhs.size_ < size_) {
                     std::copy_n(rhs.data_.GetAddress(), rhs.size_, data_.GetAddress());
-                    std::destroy_n(data_.GetAddress() + rhs.size_, size_ - rhs.size_);
+                    detail::DestroyN(data_.GetAddress() + rhs.size_, size_ - rhs.size_);
                     size_ = rhs.size_;
 
                     // Размер вектора-источника больше или равен размеру вектора-приёмника
@@ -139,8 +569,20 @@ public:
         return *this;
     }
 
-    Vector &operator=(Vector &&rhs) noexcept {
-        this->Swap(rhs);
+    Vector &operator=(Vector &&rhs) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+                                             || AllocTraits::is_always_equal::value) {
+        if (this != &rhs) {
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value
+                          || AllocTraits::is_always_equal::value) {
+                StealFrom(rhs);
+            } else if (GetAllocator() == rhs.GetAllocator()) {
+                StealFrom(rhs);
+            } else {
+                // Аллокатор остаётся прежним, элементы rhs перемещаются в наш блок
+                Vector rhs_moved(std::move(rhs), GetAllocator());
+                StealFrom(rhs_moved);
+            }
+        }
         return *this;
     }
 
@@ -149,22 +591,52 @@ public:
         data_.Swap(other.data_);
     }
 
+    allocator_type GetAllocator() const noexcept {
+        return data_.GetAllocator();
+    }
+
     ~Vector() {
-        std::destroy_n(data_.GetAddress(), size_);
+        detail::DestroyN(data_.GetAddress(), size_);
     }
 
     void Reserve(size_t new_capacity) {
         if (new_capacity <= data_.Capacity()) {
             return;
         }
-        RawMemory<T> new_data(new_capacity);
-        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-            std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
+        if constexpr (kGrowInPlace) {
+            data_.Reallocate(new_capacity);
         } else {
-            std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
+            RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+            detail::RelocateN(data_.GetAddress(), size_, new_data.GetAddress());
+            data_.Swap(new_data);
         }
-        std::destroy_n(data_.GetAddress(), size_);
-        data_.Swap(new_data);
+    }
+
+    // Перенос в новый блок выполняется параллельно с той же строгой гарантией, что и Reserve
+    void Reserve(size_t new_capacity, const ParallelPolicy &policy) {
+        if (new_capacity <= data_.Capacity()) {
+            return;
+        }
+        if constexpr (kGrowInPlace) {
+            data_.Reallocate(new_capacity);
+        } else {
+            RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+            detail::RelocateN(data_.GetAddress(), size_, new_data.GetAddress(), policy);
+            data_.Swap(new_data);
+        }
+    }
+
+    // Уничтожает все элементы, вместимость сохраняется (если политика роста не уменьшает её сама)
+    void Clear() noexcept {
+        detail::DestroyN(data_.GetAddress(), size_);
+        size_ = 0;
+        ShrinkIfSparse();
+    }
+
+    void Clear(const ParallelPolicy &policy) noexcept {
+        detail::DestroyN(data_.GetAddress(), size_, policy);
+        size_ = 0;
+        ShrinkIfSparse();
     }
 
     size_t Size() const noexcept {
@@ -185,13 +657,56 @@ public:
     }
 
     void Resize(size_t n) {
+        if constexpr (kZeroedAllocation) {
+            if (n > data_.Capacity()) {
+                // Новый блок уже обнулён, остаётся перенести в него старые элементы
+                RawMemory<T, Allocator> new_data = AllocateValueInitialized(n, data_.GetAllocator());
+                detail::RelocateN(data_.GetAddress(), size_, new_data.GetAddress());
+                data_.Swap(new_data);
+                size_ = n;
+                return;
+            }
+        }
         if (size_ < n) {
             Reserve(n);
             std::uninitialized_value_construct_n(data_ + size_, n - size_);
         } else if (size_ > n) {
-            std::destroy_n(data_ + n, size_ - n);
+            detail::DestroyN(data_ + n, size_ - n);
         }
         size_ = n;
+        ShrinkIfSparse();
+    }
+
+    // То же, что Resize, но новые элементы инициализируются по умолчанию.
+    // Подходит для буферов, которые сразу перезаписываются (read, recv, memcpy)
+    void ResizeForOverwrite(size_t n) {
+        if (size_ < n) {
+            Reserve(n);
+            std::uninitialized_default_construct_n(data_ + size_, n - size_);
+        } else if (size_ > n) {
+            detail::DestroyN(data_ + n, size_ - n);
+        }
+        size_ = n;
+        ShrinkIfSparse();
+    }
+
+    // Уменьшает вместимость до размера вектора. Пустой вектор освобождает память целиком
+    void ShrinkToFit() {
+        if (size_ < data_.Capacity()) {
+            ShrinkTo(size_);
+        }
+    }
+
+    // Добавляет в конец n элементов, инициализированных по умолчанию, и возвращает указатель
+    // на первый из них. Вместимость растёт по политике роста, как при PushBack
+    T *AppendUninitialized(size_t n) {
+        if (size_ + n > data_.Capacity()) {
+            Reserve(GrowthPolicy::NextCapacity(data_.Capacity(), size_ + n, sizeof(T)));
+        }
+        T *tail = data_ + size_;
+        std::uninitialized_default_construct_n(tail, n);
+        size_ += n;
+        return tail;
     }
 
     //воизбежание дублирования кода двумя версиями PushBack
@@ -199,46 +714,25 @@ public:
     //сделаем универсальную ссылку
     template<typename E>
     void PushBack(E &&elem) {
-        if (size_ == data_.Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : 2 * size_);
-            new(new_data + size_) T(std::forward<E>(elem));
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-            } else {
-                std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
-            }
-            std::destroy_n(data_.GetAddress(), size_);
-            data_.Swap(new_data);
-        } else {
-            new(data_ + size_) T(std::forward<E>(elem));
-        }
-        ++size_;
+        EmplaceBack(std::forward<E>(elem));
     }
 
     template<typename... Args>
     T &EmplaceBack(Args &&... args) {
         if (size_ == data_.Capacity()) {
-            RawMemory<T> new_data(size_ == 0 ? 1 : 2 * size_);
-            new(new_data.GetAddress() + size_)  T(std::forward<Args>(args)...);
-            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                std::uninitialized_move_n(data_.GetAddress(), size_, new_data.GetAddress());
-            } else {
-                std::uninitialized_copy_n(data_.GetAddress(), size_, new_data.GetAddress());
-            }
-            std::destroy_n(data_.GetAddress(), size_);
-            data_.Swap(new_data);
+            EmplaceWithReallocation(size_, std::forward<Args>(args)...);
         } else {
             new(data_ + size_)  T(std::forward<Args>(args)...);
+            ++size_;
         }
-        ++size_;
         return data_[size_ - 1];
     }
 
-
     void PopBack() {
         if (size_ > 0) {
             std::destroy_at(data_ + size_ - 1);
             --size_;
+            ShrinkIfSparse();
         }
     }
 
@@ -276,6 +770,12 @@ public:
                 return &EmplaceBack(std::forward<Args>(args)...);
             }
             //вектор был не пуст
+            if constexpr (kEmplaceInPlace<Args...>) {
+                // Аргумент может лежать внутри элементов, которые сдвинутся
+                if (!detail::AliasesRange(cbegin(), cend(), args...)) {
+                    return EmplaceInPlace(pos_num, std::forward<Args>(args)...);
+                }
+            }
             //Сначала скопируйте или переместите значение во временный объект в зависимости от версии метода Insert.
             // Так вы убережёте значение от перезаписывания, когда вставляется элемент из этого же вектора.
             T tmp(std::forward<Args>(args)...);
@@ -291,32 +791,7 @@ public:
             return (this->begin() + pos_num);
 
         } else {
-            //нужно выделить новый блок сырой памяти с удвоенной вместимостью
-            RawMemory<T> new_data(size_ == 0 ? 1 : 2 * size_);
-            //сконструировать в ней вставляемый элемент в нужной позиции,
-            // используя конструктор копирования или перемещения
-            new(new_data.GetAddress() + pos_num)  T(std::forward<Args>(args)...);
-            if (size_ > 0) {
-                //Затем копируются либо перемещаются элементы, которые предшествуют вставленному элементу
-                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                    std::uninitialized_move_n(this->begin(), pos_num, new_data.GetAddress());
-                } else {
-                    std::uninitialized_copy_n(this->begin(), pos_num, new_data.GetAddress());
-                }
-                //Затем копируются либо перемещаются элементы, которые следуют за вставляемым
-                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                    std::uninitialized_move_n(this->begin() + pos_num, size_ - pos_num,
-                                              new_data.GetAddress() + pos_num + 1);
-                } else {
-                    std::uninitialized_copy_n(this->begin() + pos_num, size_ - pos_num,
-                                              new_data.GetAddress() + pos_num + 1);
-                }
-            }
-            //
-            std::destroy_n(data_.GetAddress(), size_);
-            data_.Swap(new_data);
-            ++size_;
-            return (this->begin() + pos_num);
+            return EmplaceWithReallocation(pos_num, std::forward<Args>(args)...);
         }
     }
 
@@ -329,18 +804,341 @@ public:
             //После перемещения элементов в конце вектора останется «пустой» элемент
             std::destroy_at(std::prev(this->end()));
             --size_;
+            ShrinkIfSparse();
             return (this->begin() + offset);
         }
         return this->end();
     }
 
+    // Удаляет диапазон [first, last) одним сдвигом хвоста
+    iterator Erase(const_iterator first, const_iterator last) {
+        assert(begin() <= first && first <= last && last <= end());
+        const size_t offset = first - begin();
+        const size_t count = last - first;
+        if (count == 0) {
+            return begin() + offset;
+        }
+        T *const dst = data_ + offset;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            // Удаляемые элементы уничтожаются, хвост переезжает на их место одним memmove
+            detail::DestroyN(dst, count);
+            std::memmove(static_cast<void *>(dst), static_cast<const void *>(dst + count),
+                         (size_ - offset - count) * sizeof(T));
+        } else {
+            std::move(dst + count, end(), dst);
+            detail::DestroyN(end() - count, count);
+        }
+        size_ -= count;
+        ShrinkIfSparse();
+        return begin() + offset;
+    }
+
+    // Удаляет элемент за O(1), не сохраняя порядок: на его место переезжает последний элемент
+    iterator EraseUnordered(const_iterator pos) {
+        assert(pos >= begin() && pos < end());
+        const size_t offset = pos - begin();
+        T *const last = data_ + size_ - 1;
+        if (data_ + offset != last) {
+            data_[offset] = std::move(*last);
+        }
+        std::destroy_at(last);
+        --size_;
+        ShrinkIfSparse();
+        return begin() + offset;
+    }
+
+    // Удаляет элементы, для которых pred возвращает true, не сохраняя порядок: дыры заполняются
+    // подходящими элементами с конца. Каждый элемент проверяется один раз, перемещений не больше,
+    // чем удалённых элементов. Возвращает число удалённых элементов
+    template<typename Pred>
+    size_t EraseUnorderedIf(Pred pred) {
+        T *first = begin();
+        T *last = end();
+        while (first != last) {
+            if (!pred(std::as_const(*first))) {
+                ++first;
+                continue;
+            }
+            do {
+                --last;
+            } while (last != first && pred(std::as_const(*last)));
+            if (last == first) {
+                break;
+            }
+            *first = std::move(*last);
+            ++first;
+        }
+        const size_t removed = end() - last;
+        detail::DestroyN(last, removed);
+        size_ -= removed;
+        ShrinkIfSparse();
+        return removed;
+    }
+
+    // Удаляет все элементы, для которых pred возвращает true, за один проход.
+    // Возвращает число удалённых элементов
+    template<typename Pred>
+    friend size_t EraseIf(Vector &v, Pred pred) {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            T *write = v.begin();
+            T *read = v.begin();
+            T *const end = v.end();
+            try {
+                for (; read != end; ++read) {
+                    if (pred(std::as_const(*read))) {
+                        std::destroy_at(read);
+                    } else {
+                        if (write != read) {
+                            std::memcpy(static_cast<void *>(write), static_cast<const void *>(read), sizeof(T));
+                        }
+                        ++write;
+                    }
+                }
+            } catch (...) {
+                // Непроверенный остаток придвигается к уже сохранённым элементам
+                std::memmove(static_cast<void *>(write), static_cast<const void *>(read),
+                             (end - read) * sizeof(T));
+                v.size_ = (write - v.begin()) + (end - read);
+                throw;
+            }
+            const size_t removed = end - write;
+            v.size_ -= removed;
+            v.ShrinkIfSparse();
+            return removed;
+        } else {
+            const auto new_end = std::remove_if(v.begin(), v.end(), pred);
+            const size_t removed = v.end() - new_end;
+            v.Erase(new_end, v.end());
+            return removed;
+        }
+    }
+
     template <typename Arg>
     iterator Insert(const_iterator pos, Arg&& arg) {
         assert(pos >= begin() && pos <= end());
         return Emplace(pos, std::forward<Arg>(arg));
     }
 
+    // Вставляет count копий value перед pos не более чем с одной реаллокацией
+    iterator Insert(const_iterator pos, size_t count, const T &value) {
+        assert(pos >= begin() && pos <= end());
+        const size_t pos_num = pos - begin();
+        if (count == 0) {
+            return begin() + pos_num;
+        }
+        const T *value_ptr = std::addressof(value);
+        if (size_ + count <= data_.Capacity() && std::less_equal<const T *>()(cbegin(), value_ptr)
+            && std::less<const T *>()(value_ptr, cend())) {
+            // Значение из этого же вектора сдвинется при вставке, поэтому сначала копируем его
+            const T tmp(value);
+            return InsertForward(pos_num, detail::RepeatIterator<T>(tmp, 0), count);
+        }
+        return InsertForward(pos_num, detail::RepeatIterator<T>(value, 0), count);
+    }
+
+    iterator Insert(const_iterator pos, std::initializer_list<T> values) {
+        assert(pos >= begin() && pos <= end());
+        return InsertForward(pos - begin(), values.begin(), values.size());
+    }
+
+    // Вставляет диапазон [first, last) перед pos. Для прямых итераторов итоговый размер известен заранее:
+    // не более одной реаллокации и один сдвиг хвоста. Диапазон не должен ссылаться на элементы вектора
+    template<typename InputIt, typename = std::enable_if_t<detail::IsInputIterator<InputIt>::value>>
+    iterator Insert(const_iterator pos, InputIt first, InputIt last) {
+        assert(pos >= begin() && pos <= end());
+        const size_t pos_num = pos - begin();
+        if constexpr (detail::kIsForwardIterator<InputIt>) {
+            return InsertForward(pos_num, first, static_cast<size_t>(std::distance(first, last)));
+        } else {
+            // Однопроходный диапазон: дописываем в конец и поворачиваем на место одним проходом
+            const size_t old_size = size_;
+            for (; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+            std::rotate(begin() + pos_num, begin() + old_size, end());
+            return begin() + pos_num;
+        }
+    }
+
+    template<typename InputIt, typename = std::enable_if_t<detail::IsInputIterator<InputIt>::value>>
+    void AppendRange(InputIt first, InputIt last) {
+        Insert(cend(), first, last);
+    }
+
 private:
-    RawMemory<T> data_;
+    // Выделяет новый блок по политике роста и конструирует в нём элемент в позиции pos,
+    // после чего переносит туда остальные элементы. Элемент создаётся до переноса,
+    // поэтому аргументы могут ссылаться на элементы самого вектора
+    template<typename... Args>
+    iterator EmplaceWithReallocation(size_t pos, Args &&... args) {
+        const size_t new_capacity = GrowthPolicy::NextCapacity(data_.Capacity(), size_ + 1, sizeof(T));
+        if constexpr (kGrowInPlace) {
+            // Блок может переехать, поэтому элемент собирается во временной ячейке до роста
+            // и затем переносится на место побайтово
+            alignas(T) std::byte slot[sizeof(T)];
+            T *elem = new(slot) T(std::forward<Args>(args)...);
+            try {
+                data_.Reallocate(new_capacity);
+            } catch (...) {
+                std::destroy_at(elem);
+                throw;
+            }
+            T *dst = data_ + pos;
+            if (pos != size_) {
+                std::memmove(static_cast<void *>(dst + 1), static_cast<const void *>(dst), (size_ - pos) * sizeof(T));
+            }
+            std::memcpy(static_cast<void *>(dst), static_cast<const void *>(elem), sizeof(T));
+            ++size_;
+            return begin() + pos;
+        } else {
+            RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+            new(new_data + pos) T(std::forward<Args>(args)...);
+            try {
+                detail::RelocateWithGap(data_.GetAddress(), size_, pos, 1, new_data.GetAddress());
+            } catch (...) {
+                std::destroy_at(new_data + pos);
+                throw;
+            }
+            data_.Swap(new_data);
+            ++size_;
+            return begin() + pos;
+        }
+    }
+
+    // Аргументы самодостаточны, поэтому после сдвига элемент можно собрать прямо в освободившейся
+    // ячейке, без временного объекта. Если конструктор бросит, сдвиг откатывается без исключений
+    template<typename... Args>
+    static constexpr bool kEmplaceInPlace = (is_self_contained_v<std::decay_t<Args>> && ...)
+            && (std::is_nothrow_constructible_v<T, Args &&...>
+                || (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>));
+
+    template<typename... Args>
+    iterator EmplaceInPlace(size_t pos, Args &&... args) {
+        T *const slot = data_ + pos;
+        T *const last = data_ + size_;
+        new(last) T(std::move(*(last - 1)));
+        std::move_backward(slot, last - 1, last);
+        std::destroy_at(slot);
+        try {
+            new(slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            new(slot) T(std::move(*(slot + 1)));
+            std::move(slot + 2, last + 1, slot + 1);
+            std::destroy_at(last);
+            throw;
+        }
+        ++size_;
+        return begin() + pos;
+    }
+
+    // Вставляет count элементов, читаемых из first, в позицию pos
+    template<typename ForwardIt>
+    iterator InsertForward(size_t pos, ForwardIt first, size_t count) {
+        if (count == 0) {
+            return begin() + pos;
+        }
+        if (size_ + count > data_.Capacity()) {
+            const size_t new_capacity = GrowthPolicy::NextCapacity(data_.Capacity(), size_ + count, sizeof(T));
+            RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+            // Новые элементы создаются до переноса старых, пока источник ещё жив
+            std::uninitialized_copy_n(first, count, new_data + pos);
+            try {
+                detail::RelocateWithGap(data_.GetAddress(), size_, pos, count, new_data.GetAddress());
+            } catch (...) {
+                detail::DestroyN(new_data + pos, count);
+                throw;
+            }
+            data_.Swap(new_data);
+            size_ += count;
+            return begin() + pos;
+        }
+
+        T *const first_pos = data_ + pos;
+        T *const old_end = data_ + size_;
+        const size_t tail = size_ - pos;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            // Хвост сдвигается одним memmove; если копирование бросит, хвост возвращается на место
+            std::memmove(static_cast<void *>(first_pos + count), static_cast<const void *>(first_pos), tail * sizeof(T));
+            try {
+                std::uninitialized_copy_n(first, count, first_pos);
+            } catch (...) {
+                std::memmove(static_cast<void *>(first_pos), static_cast<const void *>(first_pos + count),
+                             tail * sizeof(T));
+                throw;
+            }
+            size_ += count;
+        } else if (count <= tail) {
+            // Последние count элементов переезжают в сырую память, остальные сдвигаются присваиванием
+            std::uninitialized_move_n(old_end - count, count, old_end);
+            size_ += count;
+            std::move_backward(first_pos, old_end - count, old_end);
+            std::copy_n(first, count, first_pos);
+        } else {
+            // Часть вставляемых элементов сразу попадает в сырую память за концом
+            ForwardIt mid = std::next(first, static_cast<std::ptrdiff_t>(tail));
+            std::uninitialized_copy_n(mid, count - tail, old_end);
+            try {
+                std::uninitialized_move_n(first_pos, tail, first_pos + count);
+            } catch (...) {
+                detail::DestroyN(old_end, count - tail);
+                throw;
+            }
+            size_ += count;
+            std::copy_n(first, tail, first_pos);
+        }
+        return begin() + pos;
+    }
+
+    // Переносит элементы в блок вместимостью new_capacity >= size_
+    void ShrinkTo(size_t new_capacity) {
+        assert(size_ <= new_capacity);
+        if constexpr (kGrowInPlace) {
+            if (new_capacity != 0) {
+                data_.Reallocate(new_capacity);
+                return;
+            }
+        }
+        RawMemory<T, Allocator> new_data(new_capacity, data_.GetAllocator());
+        detail::RelocateN(data_.GetAddress(), size_, new_data.GetAddress());
+        data_.Swap(new_data);
+    }
+
+    // Автоматическое освобождение вместимости, если политика роста это предусматривает
+    // (см. AutoShrink). Уменьшение лишь экономит память, поэтому его неудача не считается ошибкой
+    void ShrinkIfSparse() noexcept {
+        if constexpr (detail::HasShrinkCapacity<GrowthPolicy>::value) {
+            const size_t new_capacity = GrowthPolicy::ShrinkCapacity(size_, data_.Capacity(), sizeof(T));
+            if (new_capacity < data_.Capacity()) {
+                try {
+                    ShrinkTo(new_capacity);
+                } catch (...) {
+                }
+            }
+        }
+    }
+
+    // Выделяет блок под size элементов; при kZeroedAllocation он уже содержит их значения
+    static RawMemory<T, Allocator> AllocateValueInitialized(size_t size, const Allocator &alloc) {
+        if constexpr (kZeroedAllocation) {
+            return RawMemory<T, Allocator>(size, detail::kZeroed, alloc);
+        } else {
+            return RawMemory<T, Allocator>(size, alloc);
+        }
+    }
+
+    // Уничтожает свои элементы и забирает буфер rhs; аллокаторы совместимы
+    void StealFrom(Vector &rhs) noexcept {
+        detail::DestroyN(data_.GetAddress(), size_);
+        data_ = std::move(rhs.data_);
+        size_ = std::exchange(rhs.size_, 0);
+    }
+
+    RawMemory<T, Allocator> data_;
     size_t size_ = 0;
-};
\ No newline at end of file
+};
+
+namespace pmr {
+    // Vector, память которого берётся из std::pmr::memory_resource
+    template<typename T, typename GrowthPolicy = DoublingGrowth>
+    using Vector = ::Vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+}  // namespace pmr
\ No newline at end of file
@@ -0,0 +1,715 @@
+#pragma once
+
+#include "vector.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+// Линейные проходы по Vector<int32_t>, Vector<int64_t>, Vector<float> и Vector<double>
+// векторными инструкциями: Find, Contains, Count, Sum, MinMax, Fill и Equal, а для Vector<int32_t>
+// и Vector<float> ещё EraseIf с предикатами сравнения Less, Greater, InRange и EqualsAny.
+// Набор инструкций (SSE4.2, AVX2, AVX-512) выбирается при первом вызове по возможностям процессора,
+// для других процессоров и компиляторов остаются скалярные циклы. Уровень можно задать явно
+// последним аргументом; уровень выше поддерживаемого процессором понижается до лучшего доступного.
+//
+// Порядок вещественных операций. Sum и MinMax делят элементы на 64 дорожки по байтам:
+// элемент с индексом i попадает в дорожку i % (64 / sizeof(T)), и дорожки считаются
+// независимо в порядке возрастания индексов. Затем дорожки сворачиваются попарно:
+// к дорожке j прибавляется дорожка j + half, пока не останется одна. Скалярная версия считает так же,
+// поэтому результат не зависит от набора инструкций бит в бит, но сумма float и double может
+// отличаться от последовательного std::accumulate в пределах погрешности округления.
+// По той же причине данные не выравниваются отсечением первых элементов: дорожки зависели бы
+// от адреса блока. Загрузки невыровненные, и на выровненных адресах они не дороже выровненных
+namespace simd {
+    enum class Level {
+        kScalar,
+        kSse42,
+        kAvx2,
+        kAvx512,
+    };
+
+    inline const char *LevelName(Level level) noexcept {
+        switch (level) {
+            case Level::kSse42:
+                return "SSE4.2";
+            case Level::kAvx2:
+                return "AVX2";
+            case Level::kAvx512:
+                return "AVX-512";
+            default:
+                return "scalar";
+        }
+    }
+
+    // Лучший уровень, который поддерживает процессор; определяется один раз
+    inline Level DetectLevel() noexcept {
+#if defined(__GNUC__) && defined(__x86_64__)
+        static const Level level = __builtin_cpu_supports("avx512f") ? Level::kAvx512
+                                   : __builtin_cpu_supports("avx2") ? Level::kAvx2
+                                   : __builtin_cpu_supports("sse4.2") ? Level::kSse42
+                                   : Level::kScalar;
+        return level;
+#else
+        return Level::kScalar;
+#endif
+    }
+}  // namespace simd
+
+namespace detail {
+    template<typename T>
+    inline constexpr bool kSimdElement = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>
+                                         || std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    // Целые суммируются в int64_t по модулю 2^64, вещественные — в типе элемента
+    template<typename T>
+    using SimdSum = std::conditional_t<std::is_integral_v<T>, int64_t, T>;
+
+    inline constexpr size_t kSimdStripe = 64;
+
+    template<typename T>
+    inline constexpr size_t kSimdLanes = kSimdStripe / sizeof(T);
+
+    template<typename T>
+    constexpr T MinIdentity() noexcept {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::numeric_limits<T>::infinity();
+        } else {
+            return std::numeric_limits<T>::max();
+        }
+    }
+
+    template<typename T>
+    constexpr T MaxIdentity() noexcept {
+        if constexpr (std::is_floating_point_v<T>) {
+            return -std::numeric_limits<T>::infinity();
+        } else {
+            return std::numeric_limits<T>::lowest();
+        }
+    }
+
+    // Сворачивает дорожки попарно: lanes[j] = combine(lanes[j], lanes[j + half])
+    template<typename T, size_t N, typename Combine>
+    T ReduceLanes(T (&lanes)[N], Combine combine) noexcept {
+        for (size_t half = N / 2; half > 0; half /= 2) {
+            for (size_t j = 0; j < half; ++j) {
+                lanes[j] = combine(lanes[j], lanes[j + half]);
+            }
+        }
+        return lanes[0];
+    }
+
+    template<typename T>
+    T MinOf(T lhs, T rhs) noexcept {
+        return rhs < lhs ? rhs : lhs;
+    }
+
+    template<typename T>
+    T MaxOf(T lhs, T rhs) noexcept {
+        return lhs < rhs ? rhs : lhs;
+    }
+
+    // Скалярные версии; Sum и MinMax задают порядок операций, которому следуют векторные
+    template<typename T>
+    size_t FindScalar(const T *data, size_t n, T value) noexcept {
+        size_t i = 0;
+        while (i < n && !(data[i] == value)) {
+            ++i;
+        }
+        return i;
+    }
+
+    template<typename T>
+    size_t CountScalar(const T *data, size_t n, T value) noexcept {
+        size_t count = 0;
+        for (size_t i = 0; i < n; ++i) {
+            count += data[i] == value;
+        }
+        return count;
+    }
+
+    template<typename T>
+    SimdSum<T> SumTail(SimdSum<T> (&lanes)[kSimdLanes<T>], const T *tail, size_t count) noexcept {
+        if constexpr (std::is_integral_v<T>) {
+            auto sum = static_cast<uint64_t>(lanes[0]);
+            for (size_t i = 0; i < count; ++i) {
+                sum += static_cast<uint64_t>(static_cast<int64_t>(tail[i]));
+            }
+            return static_cast<int64_t>(sum);
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                lanes[i] += tail[i];
+            }
+            return ReduceLanes(lanes, [](T lhs, T rhs) {
+                return lhs + rhs;
+            });
+        }
+    }
+
+    template<typename T>
+    SimdSum<T> SumScalar(const T *data, size_t n) noexcept {
+        if constexpr (std::is_integral_v<T>) {
+            SimdSum<T> lanes[kSimdLanes<T>] = {};
+            return SumTail(lanes, data, n);
+        } else {
+            constexpr size_t lanes_count = kSimdLanes<T>;
+            T lanes[lanes_count] = {};
+            size_t i = 0;
+            for (; i + lanes_count <= n; i += lanes_count) {
+                for (size_t j = 0; j < lanes_count; ++j) {
+                    lanes[j] += data[i + j];
+                }
+            }
+            return SumTail(lanes, data + i, n - i);
+        }
+    }
+
+    template<typename T>
+    std::pair<T, T> MinMaxTail(T (&min)[kSimdLanes<T>], T (&max)[kSimdLanes<T>], const T *tail,
+                               size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            min[i] = MinOf(min[i], tail[i]);
+            max[i] = MaxOf(max[i], tail[i]);
+        }
+        return {ReduceLanes(min, MinOf<T>), ReduceLanes(max, MaxOf<T>)};
+    }
+
+    template<typename T>
+    std::pair<T, T> MinMaxScalar(const T *data, size_t n) noexcept {
+        constexpr size_t lanes_count = kSimdLanes<T>;
+        T min[lanes_count];
+        T max[lanes_count];
+        for (size_t j = 0; j < lanes_count; ++j) {
+            min[j] = MinIdentity<T>();
+            max[j] = MaxIdentity<T>();
+        }
+        size_t i = 0;
+        for (; i + lanes_count <= n; i += lanes_count) {
+            for (size_t j = 0; j < lanes_count; ++j) {
+                min[j] = MinOf(min[j], data[i + j]);
+                max[j] = MaxOf(max[j], data[i + j]);
+            }
+        }
+        return MinMaxTail(min, max, data + i, n - i);
+    }
+
+    template<typename T>
+    void FillScalar(T *data, size_t n, T value) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            data[i] = value;
+        }
+    }
+
+    template<typename T>
+    bool EqualScalar(const T *lhs, const T *rhs, size_t n) noexcept {
+        for (size_t i = 0; i < n; ++i) {
+            if (!(lhs[i] == rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Векторные ядра; определены только там, где есть векторные расширения GCC для x86-64
+    struct FindKernel;
+    struct CountKernel;
+    struct SumKernel;
+    struct MinMaxKernel;
+    struct FillKernel;
+    struct EqualKernel;
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    // Векторные типы GCC шириной Width байт. Ядра ниже написаны один раз для любой ширины
+    // и встраиваются в RunSse42, RunAvx2 и RunAvx512, собранные для своего набора инструкций:
+    // ширина 16 байт превращается в инструкции SSE, 32 — AVX2, 64 — AVX-512
+    template<typename T, size_t Width>
+    struct SimdTypes {
+        typedef T Block __attribute__((vector_size(Width)));
+        typedef uint64_t Words __attribute__((vector_size(Width)));
+        typedef int64_t Wide __attribute__((vector_size(Width)));
+        typedef uint64_t WideSum __attribute__((vector_size(Width)));
+        // Столько элементов T расширяется до Wide за один шаг
+        typedef T Narrow __attribute__((vector_size(Width * sizeof(T) / 8)));
+    };
+
+    // Блок по произвольному адресу: выравнивание 1 даёт невыровненную загрузку, may_alias
+    // разрешает читать элементы T через векторный тип
+    template<typename Block>
+    struct UnalignedBlock {
+        typedef Block Type __attribute__((aligned(1), may_alias));
+    };
+
+    // Блок возвращается ссылкой: векторный тип по значению менял бы соглашение о вызовах
+    // между функциями, собранными для разных наборов инструкций
+    template<typename Block, typename T>
+    [[gnu::always_inline]] inline const typename UnalignedBlock<Block>::Type &LoadBlock(const T *data) noexcept {
+        return *reinterpret_cast<const typename UnalignedBlock<Block>::Type *>(data);
+    }
+
+    template<typename Words, typename Mask>
+    [[gnu::always_inline]] inline bool AnyLane(const Mask &mask) noexcept {
+        const auto words = reinterpret_cast<Words>(mask);
+        uint64_t any = 0;
+        for (size_t j = 0; j < sizeof(Words) / sizeof(uint64_t); ++j) {
+            any |= words[j];
+        }
+        return any != 0;
+    }
+
+    // Блоки проверяются по четыре: маски сравнений объединяются, и горизонтальная проверка
+    // выполняется одна на четыре блока
+    inline constexpr size_t kSimdUnroll = 4;
+
+    struct FindKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static size_t Run(const T *data, size_t n, T value) noexcept {
+            using Types = SimdTypes<T, Width>;
+            using Block = typename Types::Block;
+            constexpr size_t step = Width / sizeof(T);
+            const Block key = value - Block{};
+            size_t i = 0;
+            for (; i + kSimdUnroll * step <= n; i += kSimdUnroll * step) {
+                auto found = LoadBlock<Block>(data + i) == key;
+                for (size_t b = 1; b < kSimdUnroll; ++b) {
+                    found |= LoadBlock<Block>(data + i + b * step) == key;
+                }
+                if (AnyLane<typename Types::Words>(found)) {
+                    break;
+                }
+            }
+            return i + FindScalar(data + i, n - i, value);
+        }
+    };
+
+    struct CountKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static size_t Run(const T *data, size_t n, T value) noexcept {
+            using Block = typename SimdTypes<T, Width>::Block;
+            using Mask = decltype(Block{} == Block{});
+            constexpr size_t step = Width / sizeof(T);
+            // Счётчики дорожек разрядности T не переполняются за кусок такой длины
+            constexpr size_t chunk = size_t{1} << 30;
+            const Block key = value - Block{};
+            size_t count = 0;
+            size_t i = 0;
+            while (i + step <= n) {
+                const size_t chunk_end = i + std::min(chunk, (n - i) / step * step);
+                Mask lanes = {};
+                for (; i < chunk_end; i += step) {
+                    // Совпадение даёт в дорожке маски -1
+                    lanes -= LoadBlock<Block>(data + i) == key;
+                }
+                for (size_t j = 0; j < step; ++j) {
+                    count += static_cast<size_t>(lanes[j]);
+                }
+            }
+            return count + CountScalar(data + i, n - i, value);
+        }
+    };
+
+    struct SumKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static SimdSum<T> Run(const T *data, size_t n) noexcept {
+            using Types = SimdTypes<T, Width>;
+            SimdSum<T> lanes[kSimdLanes<T>] = {};
+            size_t i = 0;
+            if constexpr (std::is_integral_v<T>) {
+                // Порядок целых сложений не влияет на результат, поэтому дорожки сворачиваются сразу
+                constexpr size_t step = Width / sizeof(uint64_t);
+                typename Types::WideSum sum = {};
+                for (; i + step <= n; i += step) {
+                    const auto wide = __builtin_convertvector(LoadBlock<typename Types::Narrow>(data + i),
+                                                              typename Types::Wide);
+                    sum += reinterpret_cast<typename Types::WideSum>(wide);
+                }
+                uint64_t total = 0;
+                for (size_t j = 0; j < step; ++j) {
+                    total += sum[j];
+                }
+                lanes[0] = static_cast<int64_t>(total);
+            } else {
+                using Block = typename Types::Block;
+                constexpr size_t step = Width / sizeof(T);
+                constexpr size_t blocks = kSimdStripe / Width;
+                Block sum[blocks] = {};
+                for (; i + kSimdLanes<T> <= n; i += kSimdLanes<T>) {
+                    for (size_t b = 0; b < blocks; ++b) {
+                        sum[b] += LoadBlock<Block>(data + i + b * step);
+                    }
+                }
+                std::memcpy(lanes, sum, sizeof(lanes));
+            }
+            return SumTail(lanes, data + i, n - i);
+        }
+    };
+
+    struct MinMaxKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static std::pair<T, T> Run(const T *data, size_t n) noexcept {
+            using Block = typename SimdTypes<T, Width>::Block;
+            constexpr size_t step = Width / sizeof(T);
+            constexpr size_t blocks = kSimdStripe / Width;
+            Block min[blocks];
+            Block max[blocks];
+            for (size_t b = 0; b < blocks; ++b) {
+                min[b] = MinIdentity<T>() - Block{};
+                max[b] = MaxIdentity<T>() - Block{};
+            }
+            size_t i = 0;
+            for (; i + kSimdLanes<T> <= n; i += kSimdLanes<T>) {
+                for (size_t b = 0; b < blocks; ++b) {
+                    const Block x = LoadBlock<Block>(data + i + b * step);
+                    min[b] = x < min[b] ? x : min[b];
+                    max[b] = max[b] < x ? x : max[b];
+                }
+            }
+            T min_lanes[kSimdLanes<T>];
+            T max_lanes[kSimdLanes<T>];
+            std::memcpy(min_lanes, min, sizeof(min_lanes));
+            std::memcpy(max_lanes, max, sizeof(max_lanes));
+            return MinMaxTail(min_lanes, max_lanes, data + i, n - i);
+        }
+    };
+
+    struct FillKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static void Run(T *data, size_t n, T value) noexcept {
+            using Block = typename SimdTypes<T, Width>::Block;
+            constexpr size_t step = Width / sizeof(T);
+            const Block block = value - Block{};
+            size_t i = 0;
+            for (; i + step <= n; i += step) {
+                std::memcpy(data + i, &block, sizeof(block));
+            }
+            FillScalar(data + i, n - i, value);
+        }
+    };
+
+    struct EqualKernel {
+        template<size_t Width, typename T>
+        [[gnu::always_inline]] static bool Run(const T *lhs, const T *rhs, size_t n) noexcept {
+            using Types = SimdTypes<T, Width>;
+            using Block = typename Types::Block;
+            constexpr size_t step = Width / sizeof(T);
+            size_t i = 0;
+            for (; i + kSimdUnroll * step <= n; i += kSimdUnroll * step) {
+                auto differs = LoadBlock<Block>(lhs + i) != LoadBlock<Block>(rhs + i);
+                for (size_t b = 1; b < kSimdUnroll; ++b) {
+                    differs |= LoadBlock<Block>(lhs + i + b * step) != LoadBlock<Block>(rhs + i + b * step);
+                }
+                if (AnyLane<typename Types::Words>(differs)) {
+                    return false;
+                }
+            }
+            return EqualScalar(lhs + i, rhs + i, n - i);
+        }
+    };
+
+    // Kernel::Run встраивается в функцию, собранную для своего набора инструкций
+    template<typename Kernel, typename... Args>
+    __attribute__((target("sse4.2"))) auto RunSse42(Args... args) {
+        return Kernel::template Run<16>(args...);
+    }
+
+    template<typename Kernel, typename... Args>
+    __attribute__((target("avx2"))) auto RunAvx2(Args... args) {
+        return Kernel::template Run<32>(args...);
+    }
+
+    template<typename Kernel, typename... Args>
+    __attribute__((target("avx512f"))) auto RunAvx512(Args... args) {
+        return Kernel::template Run<64>(args...);
+    }
+#endif
+
+    // Выполняет Kernel на уровне level или scalar на скалярном уровне.
+    // Уровень выше поддерживаемого процессором понижается до лучшего доступного
+    template<typename Kernel, typename Scalar, typename... Args>
+    auto SimdDispatch(simd::Level level, Scalar scalar, Args... args) {
+        level = std::min(level, simd::DetectLevel());
+#if defined(__GNUC__) && defined(__x86_64__)
+        switch (level) {
+            case simd::Level::kAvx512:
+                return RunAvx512<Kernel>(args...);
+            case simd::Level::kAvx2:
+                return RunAvx2<Kernel>(args...);
+            case simd::Level::kSse42:
+                return RunSse42<Kernel>(args...);
+            default:
+                break;
+        }
+#endif
+        return scalar(args...);
+    }
+
+    // Переписывает элементы src[0, n), для которых pred ложен, подряд в dst и возвращает их число.
+    // dst может совпадать с src или лежать левее: каждый элемент читается до того, как его ячейка
+    // будет перезаписана. Запись выполняется всегда, а позиция сдвигается на результат
+    // предиката, поэтому в цикле нет ветвлений
+    template<typename T, typename Pred>
+    size_t CompactScalar(const T *src, size_t n, T *dst, const Pred &pred) noexcept {
+        size_t kept = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const T value = src[i];
+            dst[kept] = value;
+            kept += !pred(value);
+        }
+        return kept;
+    }
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    // Для каждой 8-битной маски оставляемых дорожек — номера этих дорожек по порядку:
+    // vpermd по такой строке собирает оставляемые элементы в начало регистра
+    inline constexpr auto kCompactIndices = [] {
+        std::array<std::array<uint8_t, 8>, 256> indices{};
+        for (size_t mask = 0; mask < indices.size(); ++mask) {
+            size_t kept = 0;
+            for (uint8_t lane = 0; lane < 8; ++lane) {
+                if ((mask >> lane) & 1) {
+                    indices[mask][kept++] = lane;
+                }
+            }
+        }
+        return indices;
+    }();
+
+    // Блоки по 8 элементов: маска удаляемых дорожек от pred.Match, строка перестановки по маске
+    // оставляемых и запись всего регистра по текущей позиции. Запись не выходит за уже прочитанные
+    // ячейки, потому что позиция записи не правее начала блока
+    template<typename T, typename Pred>
+    __attribute__((target("avx2,popcnt"))) size_t CompactAvx2(T *data, size_t n, const Pred &pred) noexcept {
+        using Block = typename SimdTypes<T, 32>::Block;
+        using Mask = decltype(Block{} == Block{});
+        size_t kept = 0;
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const Block block = LoadBlock<Block>(data + i);
+            Mask erased;
+            pred.Match(block, erased);
+            const unsigned keep = ~static_cast<unsigned>(_mm256_movemask_ps(reinterpret_cast<__m256>(erased))) & 0xFFu;
+            const __m256i permutation = _mm256_cvtepu8_epi32(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i *>(kCompactIndices[keep].data())));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(data + kept),
+                                _mm256_permutevar8x32_epi32(reinterpret_cast<__m256i>(block), permutation));
+            kept += _mm_popcnt_u32(keep);
+        }
+        return kept + CompactScalar(data + i, n - i, data + kept, pred);
+    }
+
+    // Блоки по 16 элементов: vpcompressd собирает оставляемые дорожки по маске в начало регистра.
+    // Регистр записывается целиком: сжатие с записью в память по маске на части процессоров медленнее
+    template<typename T, typename Pred>
+    __attribute__((target("avx512f,popcnt"))) size_t CompactAvx512(T *data, size_t n, const Pred &pred) noexcept {
+        using Block = typename SimdTypes<T, 64>::Block;
+        using Mask = decltype(Block{} == Block{});
+        size_t kept = 0;
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const Block block = LoadBlock<Block>(data + i);
+            Mask erased;
+            pred.Match(block, erased);
+            const __mmask16 keep = _mm512_cmpeq_epi32_mask(reinterpret_cast<__m512i>(erased), _mm512_setzero_si512());
+            _mm512_storeu_si512(data + kept, _mm512_maskz_compress_epi32(keep, reinterpret_cast<__m512i>(block)));
+            kept += _mm_popcnt_u32(keep);
+        }
+        return kept + CompactScalar(data + i, n - i, data + kept, pred);
+    }
+#endif
+
+    // Сжимает data[0, n) на месте и возвращает число оставшихся элементов. Векторные версии
+    // есть для AVX2 и AVX-512, на уровне SSE4.2 работает скалярный цикл без ветвлений.
+    // Уровень, как и в SimdDispatch, не выше поддерживаемого процессором
+    template<typename T, typename Pred>
+    size_t CompactDispatch(simd::Level level, T *data, size_t n, const Pred &pred) noexcept {
+        level = std::min(level, simd::DetectLevel());
+#if defined(__GNUC__) && defined(__x86_64__)
+        switch (level) {
+            case simd::Level::kAvx512:
+                return CompactAvx512(data, n, pred);
+            case simd::Level::kAvx2:
+                return CompactAvx2(data, n, pred);
+            default:
+                break;
+        }
+#endif
+        return CompactScalar(data, n, data, pred);
+    }
+}  // namespace detail
+
+namespace simd {
+    // Первый элемент, равный value, или end()
+    template<typename T, typename Alloc, typename Growth>
+    const T *Find(const Vector<T, Alloc, Growth> &v, T value, Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        return v.begin() + detail::SimdDispatch<detail::FindKernel>(level, detail::FindScalar<T>, v.begin(),
+                                                                    v.Size(), value);
+    }
+
+    template<typename T, typename Alloc, typename Growth>
+    T *Find(Vector<T, Alloc, Growth> &v, T value, Level level = DetectLevel()) {
+        return const_cast<T *>(Find(std::as_const(v), value, level));
+    }
+
+    template<typename T, typename Alloc, typename Growth>
+    bool Contains(const Vector<T, Alloc, Growth> &v, T value, Level level = DetectLevel()) {
+        return Find(v, value, level) != v.end();
+    }
+
+    template<typename T, typename Alloc, typename Growth>
+    size_t Count(const Vector<T, Alloc, Growth> &v, T value, Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        return detail::SimdDispatch<detail::CountKernel>(level, detail::CountScalar<T>, v.begin(), v.Size(), value);
+    }
+
+    // Сумма в порядке дорожек (см. начало файла); целые складываются в int64_t
+    template<typename T, typename Alloc, typename Growth>
+    detail::SimdSum<T> Sum(const Vector<T, Alloc, Growth> &v, Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        return detail::SimdDispatch<detail::SumKernel>(level, detail::SumScalar<T>, v.begin(), v.Size());
+    }
+
+    // Наименьший и наибольший элементы непустого вектора. NaN пропускаются; если других значений нет,
+    // возвращается {+inf, -inf}. Из равных нулей разного знака выбирается тот, что остаётся
+    // после сворачивания дорожек
+    template<typename T, typename Alloc, typename Growth>
+    std::pair<T, T> MinMax(const Vector<T, Alloc, Growth> &v, Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        assert(v.Size() > 0);
+        return detail::SimdDispatch<detail::MinMaxKernel>(level, detail::MinMaxScalar<T>, v.begin(), v.Size());
+    }
+
+    template<typename T, typename Alloc, typename Growth>
+    void Fill(Vector<T, Alloc, Growth> &v, T value, Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        detail::SimdDispatch<detail::FillKernel>(level, detail::FillScalar<T>, v.begin(), v.Size(), value);
+    }
+
+    // Поэлементное сравнение operator==, как в std::equal: NaN не равен себе, -0.0 равен 0.0
+    template<typename T, typename Alloc, typename Growth>
+    bool Equal(const Vector<T, Alloc, Growth> &lhs, const Vector<T, Alloc, Growth> &rhs,
+               Level level = DetectLevel()) {
+        static_assert(detail::kSimdElement<T>);
+        return lhs.Size() == rhs.Size()
+               && detail::SimdDispatch<detail::EqualKernel>(level, detail::EqualScalar<T>, lhs.begin(), rhs.begin(),
+                                                            lhs.Size());
+    }
+
+    // Предикаты EraseIf. operator() проверяет один элемент, Match заполняет маску удаляемых дорожек
+    // блока векторного типа GCC (-1 там, где предикат истинен) и вычисляет тот же предикат
+
+    // Удаляет элементы меньше threshold
+    template<typename T>
+    struct Less {
+        explicit Less(T threshold) noexcept
+                : threshold(threshold) {
+        }
+
+        bool operator()(T value) const noexcept {
+            return value < threshold;
+        }
+
+        template<typename Block, typename Mask>
+        void Match(const Block &block, Mask &erased) const noexcept {
+            erased = block < threshold - Block{};
+        }
+
+        T threshold;
+    };
+
+    // Удаляет элементы больше threshold
+    template<typename T>
+    struct Greater {
+        explicit Greater(T threshold) noexcept
+                : threshold(threshold) {
+        }
+
+        bool operator()(T value) const noexcept {
+            return threshold < value;
+        }
+
+        template<typename Block, typename Mask>
+        void Match(const Block &block, Mask &erased) const noexcept {
+            erased = threshold - Block{} < block;
+        }
+
+        T threshold;
+    };
+
+    // Удаляет элементы из полуинтервала [low, high)
+    template<typename T>
+    struct InRange {
+        InRange(T low, T high) noexcept
+                : low(low), high(high) {
+        }
+
+        bool operator()(T value) const noexcept {
+            return low <= value && value < high;
+        }
+
+        template<typename Block, typename Mask>
+        void Match(const Block &block, Mask &erased) const noexcept {
+            erased = (block >= low - Block{}) & (block < high - Block{});
+        }
+
+        T low;
+        T high;
+    };
+
+    // Удаляет элементы, равные одному из не более чем kMaxValues значений;
+    // при большем числе значений конструктор бросает std::length_error
+    template<typename T>
+    struct EqualsAny {
+        static constexpr size_t kMaxValues = 8;
+
+        EqualsAny(std::initializer_list<T> values)
+                : count(values.size()) {
+            if (values.size() > kMaxValues) {
+                throw std::length_error("EqualsAny accepts at most kMaxValues values");
+            }
+            std::copy(values.begin(), values.end(), this->values.begin());
+        }
+
+        bool operator()(T value) const noexcept {
+            bool equal = false;
+            for (size_t i = 0; i < count; ++i) {
+                equal |= value == values[i];
+            }
+            return equal;
+        }
+
+        template<typename Block, typename Mask>
+        void Match(const Block &block, Mask &erased) const noexcept {
+            erased = Mask{};
+            for (size_t i = 0; i < count; ++i) {
+                erased |= block == values[i] - Block{};
+            }
+        }
+
+        std::array<T, kMaxValues> values{};
+        size_t count;
+    };
+
+    // Удаляет из Vector<int32_t> или Vector<float> элементы, для которых pred истинен, сохраняя порядок
+    // остальных, и возвращает число удалённых. Оставшиеся элементы сжимаются на месте одним проходом,
+    // а размер вектора меняется один раз в конце
+    template<typename T, typename Alloc, typename Growth, typename Pred>
+    size_t EraseIf(Vector<T, Alloc, Growth> &v, const Pred &pred, Level level = DetectLevel()) {
+        static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, float>);
+        const size_t kept = detail::CompactDispatch(level, v.begin(), v.Size(), pred);
+        const size_t erased = v.Size() - kept;
+        v.Erase(v.begin() + kept, v.end());
+        return erased;
+    }
+}  // namespace simd
@@ -0,0 +1,664 @@
+#include "advanced-vector/bit_vector.h"
+#include "advanced-vector/concurrent_vector.h"
+#include "advanced-vector/eytzinger_index.h"
+#include "advanced-vector/flat_map.h"
+#include "advanced-vector/gap_buffer.h"
+#include "advanced-vector/ring_vector.h"
+#include "advanced-vector/segmented_vector.h"
+#include "advanced-vector/soa_vector.h"
+#include "advanced-vector/vector.h"
+#include "advanced-vector/vector_simd.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    double SecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Замер выполняется в дочернем процессе, чтобы пиковый RSS одного замера не влиял на другой
+    template<typename F>
+    void RunIsolated(std::string_view name, F f) {
+        std::cout.flush();
+        const pid_t pid = fork();
+        if (pid == 0) {
+            const auto start = Clock::now();
+            f();
+            const double seconds = SecondsSince(start);
+            rusage usage{};
+            getrusage(RUSAGE_SELF, &usage);
+            std::cout << std::left << std::setw(40) << name
+                      << " time: " << std::fixed << std::setprecision(3) << seconds << " s"
+                      << "  peak RSS: " << usage.ru_maxrss / 1024 << " MB" << std::endl;
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+
+    template<typename Allocator>
+    void GrowTo(size_t bytes) {
+        Vector<uint64_t, Allocator> v;
+        const size_t count = bytes / sizeof(uint64_t);
+        for (size_t i = 0; i < count; ++i) {
+            v.PushBack(i);
+        }
+        if (v[count / 2] != count / 2) {
+            std::abort();
+        }
+    }
+
+    // growth [MB]: рост Vector<uint64_t> через PushBack до заданного объёма
+    void BenchmarkGrowth(size_t megabytes) {
+        const size_t bytes = megabytes << 20;
+        std::cout << "growth to " << megabytes << " MB" << std::endl;
+        RunIsolated("std::allocator (allocate + copy)", [bytes] {
+            GrowTo<std::allocator<uint64_t>>(bytes);
+        });
+        RunIsolated("MallocAllocator (realloc/mremap)", [bytes] {
+            GrowTo<MallocAllocator<uint64_t>>(bytes);
+        });
+    }
+
+    // Создаёт Vector<int> из count нулей и пишет в каждый stride-й элемент
+    template<typename Allocator>
+    void ZeroedSparseTouch(size_t count, size_t stride) {
+        Vector<int, Allocator> v(count);
+        for (size_t i = 0; i < count; i += stride) {
+            v[i] = 1;
+        }
+        if (v[stride] != 1) {
+            std::abort();
+        }
+    }
+
+    // zeroed [MB stride]: Vector<int>(n) с обнулением записью и с обнулёнными страницами
+    void BenchmarkZeroed(size_t megabytes, size_t stride) {
+        const size_t count = (megabytes << 20) / sizeof(int);
+        std::cout << "value-initialized Vector<int> of " << megabytes << " MB, touching every "
+                  << stride << "-th element" << std::endl;
+        RunIsolated("std::allocator (value-init loop)", [=] {
+            ZeroedSparseTouch<std::allocator<int>>(count, stride);
+        });
+        RunIsolated("MallocAllocator (zeroed pages)", [=] {
+            ZeroedSparseTouch<MallocAllocator<int>>(count, stride);
+        });
+    }
+
+    // Время заполнения по одному элементу и доля неиспользуемой вместимости для политики роста
+    template<typename Policy>
+    void BenchmarkPolicy(size_t small_count, size_t small_size, size_t large_size) {
+        auto start = Clock::now();
+        size_t small_capacity = 0;
+        for (size_t i = 0; i < small_count; ++i) {
+            Vector<uint32_t, std::allocator<uint32_t>, Policy> v;
+            for (size_t j = 0; j < small_size; ++j) {
+                v.PushBack(static_cast<uint32_t>(j));
+            }
+            small_capacity += v.Capacity();
+        }
+        const double small_seconds = SecondsSince(start);
+
+        start = Clock::now();
+        Vector<uint32_t, std::allocator<uint32_t>, Policy> v;
+        for (size_t i = 0; i < large_size; ++i) {
+            v.PushBack(static_cast<uint32_t>(i));
+        }
+        const double large_seconds = SecondsSince(start);
+
+        const auto waste = [](size_t size, size_t capacity) {
+            return 100.0 * static_cast<double>(capacity - size) / static_cast<double>(capacity);
+        };
+        std::cout << std::left << std::setw(18) << Policy::kName << std::fixed << std::setprecision(3)
+                  << " small: " << small_seconds << " s, " << std::setprecision(1)
+                  << waste(small_count * small_size, small_capacity) << "% unused"
+                  << std::setprecision(3) << "  large: " << large_seconds << " s, " << std::setprecision(1)
+                  << waste(large_size, v.Capacity()) << "% unused" << std::endl;
+    }
+
+    // growth-policy [small_count small_size large_size]: сравнение политик роста
+    void BenchmarkGrowthPolicies(size_t small_count, size_t small_size, size_t large_size) {
+        std::cout << "growth policies: " << small_count << " vectors of " << small_size
+                  << " elements, one vector of " << large_size << " elements" << std::endl;
+        BenchmarkPolicy<DoublingGrowth>(small_count, small_size, large_size);
+        BenchmarkPolicy<OneAndHalfGrowth>(small_count, small_size, large_size);
+        BenchmarkPolicy<CacheLineGrowth<>>(small_count, small_size, large_size);
+        BenchmarkPolicy<PageRoundedGrowth<>>(small_count, small_size, large_size);
+        BenchmarkPolicy<HugePageRoundedGrowth>(small_count, small_size, large_size);
+    }
+
+    // Фазы жизни Vector<std::string> из count элементов при заданном числе потоков
+    void BenchmarkParallelPhases(size_t count, unsigned threads) {
+        const ParallelPolicy policy{threads};
+        auto start = Clock::now();
+        Vector<std::string> v(count, policy);
+        const double construct = SecondsSince(start);
+
+        start = Clock::now();
+        const Vector<std::string> copy(v, policy);
+        const double copy_seconds = SecondsSince(start);
+
+        start = Clock::now();
+        v.Reserve(count * 2, policy);
+        const double reserve = SecondsSince(start);
+
+        start = Clock::now();
+        v.Clear(policy);
+        const double clear = SecondsSince(start);
+        if (copy.Size() != count) {
+            std::abort();
+        }
+        std::cout << std::fixed << std::setprecision(3) << "construct: " << construct << " s  copy: " << copy_seconds
+                  << " s  reserve: " << reserve << " s  clear: " << clear << " s" << std::endl;
+    }
+
+    // parallel [millions max_threads]: масштабирование параллельного режима от 1 до max_threads потоков
+    void BenchmarkParallel(size_t millions, size_t max_threads) {
+        const size_t count = millions * 1'000'000;
+        std::cout << "parallel Vector<std::string> of " << millions << "M elements, "
+                  << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        for (size_t threads = 1; threads <= max_threads; ++threads) {
+            RunIsolated(std::to_string(threads) + " threads, total", [=] {
+                BenchmarkParallelPhases(count, static_cast<unsigned>(threads));
+            });
+        }
+    }
+
+    // Общее время заполнения и самый долгий одиночный PushBack
+    template<typename Container>
+    void MeasureAppendLatency(std::string_view name, size_t count) {
+        Container v;
+        double worst = 0;
+        const auto start = Clock::now();
+        for (size_t i = 0; i < count; ++i) {
+            const auto push_start = Clock::now();
+            v.PushBack(i);
+            worst = std::max(worst, SecondsSince(push_start));
+        }
+        const double seconds = SecondsSince(start);
+        std::cout << std::left << std::setw(28) << name << std::fixed << std::setprecision(3)
+                  << " total: " << seconds << " s  worst PushBack: " << worst * 1000 << " ms" << std::endl;
+    }
+
+    // append-latency [millions]: задержки роста Vector и SegmentedVector
+    void BenchmarkAppendLatency(size_t millions) {
+        const size_t count = millions * 1'000'000;
+        std::cout << "append latency, " << millions << "M uint64_t" << std::endl;
+        RunIsolated("Vector, total", [count] {
+            MeasureAppendLatency<Vector<uint64_t>>("Vector", count);
+        });
+        RunIsolated("SegmentedVector, total", [count] {
+            MeasureAppendLatency<SegmentedVector<uint64_t>>("SegmentedVector", count);
+        });
+    }
+
+    struct Record {
+        int64_t quantity;
+        double price;
+        int32_t id;
+        int32_t flags;
+        char symbol[16];
+    };
+
+    // soa [millions passes]: сумма одного поля по Vector<Record> и по столбцу SoAVector
+    void BenchmarkSoA(size_t millions, size_t passes) {
+        const size_t count = millions * 1'000'000;
+        std::cout << "sum of one field over " << millions << "M records (" << sizeof(Record)
+                  << " bytes each), " << passes << " passes" << std::endl;
+        const auto report = [passes, count](std::string_view name, double seconds, int64_t sum) {
+            const double gigabytes = static_cast<double>(passes * count * sizeof(int64_t)) / (1 << 30);
+            std::cout << std::left << std::setw(24) << name << std::fixed << std::setprecision(3)
+                      << " time: " << seconds << " s  useful bandwidth: " << gigabytes / seconds
+                      << " GB/s  (sum " << sum << ")" << std::endl;
+        };
+        RunIsolated("Vector<Record>, total", [=] {
+            Vector<Record> v(count);
+            for (size_t i = 0; i < count; ++i) {
+                v[i].quantity = static_cast<int64_t>(i);
+            }
+            const auto start = Clock::now();
+            int64_t sum = 0;
+            for (size_t pass = 0; pass < passes; ++pass) {
+                for (const Record &record: v) {
+                    sum += record.quantity;
+                }
+            }
+            report("Vector<Record>", SecondsSince(start), sum);
+        });
+        RunIsolated("SoAVector, total", [=] {
+            SoAVector<int64_t, double, int32_t, int32_t, std::array<char, 16>> v;
+            v.Reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                v.EmplaceBack(static_cast<int64_t>(i), 0.0, 0, 0, std::array<char, 16>{});
+            }
+            const auto start = Clock::now();
+            int64_t sum = 0;
+            for (size_t pass = 0; pass < passes; ++pass) {
+                for (const int64_t quantity: v.Span<0>()) {
+                    sum += quantity;
+                }
+            }
+            report("SoAVector::Span<0>", SecondsSince(start), sum);
+        });
+    }
+
+    // bitvector [millions]: флаги в Vector<bool> и в BitVector, установлен каждый 7-й
+    void BenchmarkBitVector(size_t millions) {
+        const size_t count = millions * 1'000'000;
+        std::cout << "flags over " << millions << "M rows" << std::endl;
+        RunIsolated("Vector<bool>, total", [count] {
+            Vector<bool> flags(count);
+            for (size_t i = 0; i < count; i += 7) {
+                flags[i] = true;
+            }
+            const auto start = Clock::now();
+            const size_t set = std::count(flags.begin(), flags.end(), true);
+            std::cout << "Vector<bool> count: " << std::fixed << std::setprecision(3)
+                      << SecondsSince(start) << " s (" << set << ")" << std::endl;
+        });
+        RunIsolated("BitVector, total", [count] {
+            BitVector flags(count);
+            for (size_t i = 0; i < count; i += 7) {
+                flags.Set(i);
+            }
+            auto start = Clock::now();
+            const size_t set = flags.Count();
+            std::cout << "BitVector count: " << std::fixed << std::setprecision(3)
+                      << SecondsSince(start) << " s (" << set << ")";
+            start = Clock::now();
+            size_t visited = 0;
+            for (size_t i = flags.FindFirst(); i != BitVector::kNpos; i = flags.FindNext(i)) {
+                ++visited;
+            }
+            std::cout << ", FindFirst/FindNext walk: " << SecondsSince(start) << " s (" << visited << ")" << std::endl;
+        });
+    }
+
+    // fifo [window millions]: очередь фиксированной длины на Vector (Erase(begin())) и на RingVector
+    void BenchmarkFifo(size_t window, size_t millions) {
+        const size_t operations = millions * 1'000'000;
+        std::cout << "FIFO of " << window << " uint64_t, " << millions << "M enqueue/dequeue pairs" << std::endl;
+        RunIsolated("Vector + Erase(begin())", [=] {
+            Vector<uint64_t> queue;
+            for (size_t i = 0; i < window; ++i) {
+                queue.PushBack(i);
+            }
+            for (size_t i = 0; i < operations; ++i) {
+                queue.Erase(queue.cbegin());
+                queue.PushBack(i);
+            }
+        });
+        RunIsolated("RingVector", [=] {
+            RingVector<uint64_t> queue;
+            for (size_t i = 0; i < window; ++i) {
+                queue.PushBack(i);
+            }
+            for (size_t i = 0; i < operations; ++i) {
+                queue.PopFront();
+                queue.PushBack(i);
+            }
+        });
+    }
+
+    // Вставляет edits символов в текст из size символов; позиция вставки блуждает рядом с курсором
+    template<typename Text>
+    void ClusteredInserts(size_t size, size_t edits) {
+        Text text;
+        for (size_t i = 0; i < size; ++i) {
+            text.PushBack(static_cast<char>('a' + i % 26));
+        }
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> step(-8, 8);
+        size_t cursor = size / 3;
+        for (size_t i = 0; i < edits; ++i) {
+            const long next = static_cast<long>(cursor) + step(random);
+            cursor = std::min(text.Size(), static_cast<size_t>(std::max(0L, next)));
+            text.Insert(text.cbegin() + cursor, 'x');
+        }
+        if (text.Size() != size + edits) {
+            std::abort();
+        }
+    }
+
+    // gap-buffer [size_mb edits_k]: вставки рядом с блуждающим курсором в Vector<char> и GapBuffer<char>
+    void BenchmarkGapBuffer(size_t megabytes, size_t thousands) {
+        const size_t size = megabytes << 20;
+        const size_t edits = thousands * 1000;
+        std::cout << "clustered inserts into " << megabytes << " MB of text, " << thousands << "K edits" << std::endl;
+        RunIsolated("Vector<char>::Insert", [=] {
+            ClusteredInserts<Vector<char>>(size, edits);
+        });
+        RunIsolated("GapBuffer<char>::Insert", [=] {
+            ClusteredInserts<GapBuffer<char>>(size, edits);
+        });
+    }
+
+    // Среднее время поиска в наносекундах по заранее перемешанным существующим ключам
+    template<typename Lookup>
+    double NanosecondsPerLookup(const Vector<uint64_t> &probes, Lookup lookup) {
+        uint64_t found = 0;
+        const auto start = Clock::now();
+        for (const uint64_t key: probes) {
+            found += lookup(key);
+        }
+        const double seconds = SecondsSince(start);
+        if (found != probes.Size()) {
+            std::abort();
+        }
+        return seconds * 1e9 / static_cast<double>(probes.Size());
+    }
+
+    // flat-map [max_keys probes_millions]: поиск в std::map, std::unordered_map и FlatMap от 100 ключей
+    void BenchmarkFlatMap(size_t max_keys, size_t probes_millions) {
+        std::cout << "lookup ns/op for uint64_t -> uint64_t, " << probes_millions << "M probes" << std::endl;
+        std::mt19937_64 random(42);
+        for (size_t count = 100; count <= max_keys; count *= 10) {
+            Vector<uint64_t> keys;
+            Vector<std::pair<uint64_t, uint64_t>> items;
+            for (size_t i = 0; i < count; ++i) {
+                keys.PushBack(random());
+                items.PushBack(std::pair(keys[i], i));
+            }
+            Vector<uint64_t> probes;
+            std::uniform_int_distribution<size_t> pick(0, count - 1);
+            for (size_t i = 0; i < probes_millions * 1'000'000; ++i) {
+                probes.PushBack(keys[pick(random)]);
+            }
+
+            const std::map<uint64_t, uint64_t> tree(items.begin(), items.end());
+            const std::unordered_map<uint64_t, uint64_t> hash(items.begin(), items.end());
+            FlatMap<uint64_t, uint64_t> flat;
+            flat.InsertSorted(items.begin(), items.end());
+            FlatMap<uint64_t, uint64_t, std::less<>, true> flat_split;
+            flat_split.InsertSorted(items.begin(), items.end());
+
+            std::cout << std::left << std::setw(8) << count << std::fixed << std::setprecision(1)
+                      << " std::map: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                          return tree.count(key);
+                      })
+                      << "  std::unordered_map: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                          return hash.count(key);
+                      })
+                      << "  FlatMap: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                          return flat.Contains(key);
+                      })
+                      << "  FlatMap split: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                          return flat_split.Contains(key);
+                      }) << std::endl;
+        }
+    }
+
+    // eytzinger [millions probes_millions]: проверка принадлежности по отсортированному Vector<uint64_t>
+    // через std::lower_bound и через EytzingerIndex
+    void BenchmarkEytzinger(size_t millions, size_t probes_millions) {
+        const size_t count = millions * 1'000'000;
+        std::cout << "membership ns/op over " << millions << "M sorted uint64_t, " << probes_millions << "M probes"
+                  << std::endl;
+        std::mt19937_64 random(42);
+        Vector<uint64_t> keys(count, kDefaultInit);
+        for (uint64_t &key: keys) {
+            key = random();
+        }
+        std::sort(keys.begin(), keys.end());
+        Vector<uint64_t> probes;
+        std::uniform_int_distribution<size_t> pick(0, count - 1);
+        for (size_t i = 0; i < probes_millions * 1'000'000; ++i) {
+            probes.PushBack(keys[pick(random)]);
+        }
+
+        auto start = Clock::now();
+        const EytzingerIndex<uint64_t> index(keys);
+        std::cout << std::fixed << std::setprecision(3) << "rebuild: " << SecondsSince(start) << " s";
+        start = Clock::now();
+        const EytzingerIndex<uint64_t> parallel_index(keys, kParallel);
+        std::cout << ", parallel rebuild: " << SecondsSince(start) << " s" << std::endl;
+
+        std::cout << std::setprecision(1) << "std::lower_bound: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                      const uint64_t *it = std::lower_bound(keys.begin(), keys.end(), key);
+                      return it != keys.end() && *it == key;
+                  })
+                  << "  EytzingerIndex: " << NanosecondsPerLookup(probes, [&](uint64_t key) {
+                      return index.Contains(key);
+                  }) << std::endl;
+    }
+
+    // Пропускная способность op в ГБ/с: op(level) читает или пишет bytes байт и повторяется repeats раз
+    template<typename Op>
+    void PrintSimdThroughput(const std::string &name, size_t bytes, size_t repeats, Op op) {
+        std::cout << std::left << std::setw(16) << name;
+        for (int level = 0; level <= static_cast<int>(simd::DetectLevel()); ++level) {
+            const auto start = Clock::now();
+            for (size_t i = 0; i < repeats; ++i) {
+                op(static_cast<simd::Level>(level));
+            }
+            const double seconds = SecondsSince(start);
+            std::cout << std::right << std::setw(10) << std::fixed << std::setprecision(1)
+                      << static_cast<double>(bytes) * static_cast<double>(repeats) / seconds / 1e9;
+        }
+        std::cout << std::endl;
+    }
+
+    template<typename T>
+    void BenchmarkSimdKernels(const std::string &type, size_t kilobytes, size_t repeats) {
+        const size_t count = (kilobytes << 10) / sizeof(T);
+        const size_t bytes = count * sizeof(T);
+        Vector<T> values(count, kDefaultInit);
+        std::mt19937 random(42);
+        for (T &value: values) {
+            value = static_cast<T>(random() % 1000);
+        }
+        const Vector<T> copy(values);
+        const T absent = static_cast<T>(-1);
+        volatile size_t sink = 0;
+
+        PrintSimdThroughput("Find " + type, bytes, repeats, [&](simd::Level level) {
+            sink = sink + (simd::Find(values, absent, level) - values.begin());
+        });
+        PrintSimdThroughput("Count " + type, bytes, repeats, [&](simd::Level level) {
+            sink = sink + simd::Count(values, T{7}, level);
+        });
+        PrintSimdThroughput("Sum " + type, bytes, repeats, [&](simd::Level level) {
+            sink = sink + static_cast<size_t>(simd::Sum(values, level));
+        });
+        PrintSimdThroughput("MinMax " + type, bytes, repeats, [&](simd::Level level) {
+            sink = sink + static_cast<size_t>(simd::MinMax(values, level).second);
+        });
+        PrintSimdThroughput("Equal " + type, 2 * bytes, repeats, [&](simd::Level level) {
+            sink = sink + simd::Equal(values, copy, level);
+        });
+        PrintSimdThroughput("Fill " + type, bytes, repeats, [&](simd::Level level) {
+            simd::Fill(values, T{1}, level);
+        });
+    }
+
+    // simd [kilobytes repeats]: ГБ/с ядер vector_simd.h на каждом уровне, который поддерживает процессор
+    void BenchmarkSimd(size_t kilobytes, size_t repeats) {
+        std::cout << "GB/s over " << kilobytes << " KB, " << repeats << " passes" << std::endl << std::setw(16) << "";
+        for (int level = 0; level <= static_cast<int>(simd::DetectLevel()); ++level) {
+            std::cout << std::right << std::setw(10) << simd::LevelName(static_cast<simd::Level>(level));
+        }
+        std::cout << std::endl;
+        BenchmarkSimdKernels<int32_t>("int32_t", kilobytes, repeats);
+        BenchmarkSimdKernels<int64_t>("int64_t", kilobytes, repeats);
+        BenchmarkSimdKernels<float>("float", kilobytes, repeats);
+        BenchmarkSimdKernels<double>("double", kilobytes, repeats);
+    }
+
+    // Входные ГБ/с удаления: erase(v) выполняется repeats раз над свежей копией values, копирование не замеряется
+    template<typename T, typename Erase>
+    void PrintFilterThroughput(const std::string &name, const Vector<T> &values, size_t repeats, Erase erase) {
+        double seconds = 0;
+        size_t erased = 0;
+        for (size_t i = 0; i < repeats; ++i) {
+            Vector<T> v(values);
+            const auto start = Clock::now();
+            erased += erase(v);
+            seconds += SecondsSince(start);
+        }
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(8) << static_cast<double>(values.Size() * sizeof(T) * repeats) / seconds / 1e9
+                  << " GB/s (" << erased / repeats << " erased)" << std::endl;
+    }
+
+    template<typename T>
+    void BenchmarkFilterType(const std::string &type, size_t count, size_t repeats) {
+        Vector<T> values(count, kDefaultInit);
+        std::mt19937 random(42);
+        for (T &value: values) {
+            value = static_cast<T>(random() % 1000);
+        }
+        // Половина элементов удаляется в случайном порядке: худший случай для предсказателя переходов
+        const T threshold = static_cast<T>(500);
+        PrintFilterThroughput(type + " EraseIf", values, repeats, [threshold](Vector<T> &v) {
+            return EraseIf(v, [threshold](T value) {
+                return value < threshold;
+            });
+        });
+        for (int level = 0; level <= static_cast<int>(simd::DetectLevel()); ++level) {
+            const auto l = static_cast<simd::Level>(level);
+            PrintFilterThroughput(type + " simd::EraseIf " + simd::LevelName(l), values, repeats,
+                                  [threshold, l](Vector<T> &v) {
+                                      return simd::EraseIf(v, simd::Less(threshold), l);
+                                  });
+        }
+    }
+
+    // filter [millions repeats]: удаление элементов меньше порога из Vector<int32_t> и Vector<float>
+    void BenchmarkFilter(size_t millions, size_t repeats) {
+        std::cout << "threshold filter over " << millions << "M elements, " << repeats << " passes" << std::endl;
+        BenchmarkFilterType<int32_t>("int32_t", millions * 1'000'000, repeats);
+        BenchmarkFilterType<float>("float", millions * 1'000'000, repeats);
+    }
+
+    // Запускает threads потоков, каждый из которых вызывает append(value) per_thread раз
+    template<typename Append>
+    void AppendFromThreads(size_t threads, size_t per_thread, Append append) {
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([=, &append] {
+                for (size_t i = 0; i < per_thread; ++i) {
+                    append(t * per_thread + i);
+                }
+            });
+        }
+        for (std::thread &worker: workers) {
+            worker.join();
+        }
+    }
+
+    // concurrent [max_threads millions]: добавление из нескольких потоков в ConcurrentVector
+    // и в Vector под std::mutex
+    void BenchmarkConcurrent(size_t max_threads, size_t millions) {
+        const size_t total = millions * 1'000'000;
+        std::cout << "concurrent append of " << millions << "M uint64_t, "
+                  << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+        for (size_t threads = 1; threads <= max_threads; ++threads) {
+            const std::string suffix = " x" + std::to_string(threads);
+            RunIsolated("ConcurrentVector" + suffix, [=] {
+                ConcurrentVector<uint64_t> v;
+                AppendFromThreads(threads, total / threads, [&v](uint64_t value) {
+                    v.EmplaceBack(value);
+                });
+            });
+            RunIsolated("Vector + std::mutex" + suffix, [=] {
+                Vector<uint64_t> v;
+                std::mutex mutex;
+                AppendFromThreads(threads, total / threads, [&](uint64_t value) {
+                    std::lock_guard guard(mutex);
+                    v.PushBack(value);
+                });
+            });
+        }
+    }
+
+    size_t ArgOr(int argc, char *argv[], int index, size_t value) {
+        return argc > index ? std::stoull(argv[index]) : value;
+    }
+
+}  // namespace
+
+// Использование: Vector_benchmark [имя замера [параметры]]; без аргументов запускаются все замеры
+int main(int argc, char *argv[]) {
+    const std::map<std::string, std::function<void(int, char *[])>> benchmarks = {
+            {"append-latency", [](int argc, char *argv[]) {
+                BenchmarkAppendLatency(ArgOr(argc, argv, 2, 64));
+            }},
+            {"bitvector", [](int argc, char *argv[]) {
+                BenchmarkBitVector(ArgOr(argc, argv, 2, 1000));
+            }},
+            {"concurrent", [](int argc, char *argv[]) {
+                BenchmarkConcurrent(ArgOr(argc, argv, 2, std::max(4u, std::thread::hardware_concurrency())),
+                                    ArgOr(argc, argv, 3, 64));
+            }},
+            {"eytzinger", [](int argc, char *argv[]) {
+                BenchmarkEytzinger(ArgOr(argc, argv, 2, 100), ArgOr(argc, argv, 3, 10));
+            }},
+            {"fifo", [](int argc, char *argv[]) {
+                BenchmarkFifo(ArgOr(argc, argv, 2, 4096), ArgOr(argc, argv, 3, 10));
+            }},
+            {"filter", [](int argc, char *argv[]) {
+                BenchmarkFilter(ArgOr(argc, argv, 2, 16), ArgOr(argc, argv, 3, 10));
+            }},
+            {"flat-map", [](int argc, char *argv[]) {
+                BenchmarkFlatMap(ArgOr(argc, argv, 2, 1'000'000), ArgOr(argc, argv, 3, 2));
+            }},
+            {"gap-buffer", [](int argc, char *argv[]) {
+                BenchmarkGapBuffer(ArgOr(argc, argv, 2, 4), ArgOr(argc, argv, 3, 50));
+            }},
+            {"growth", [](int argc, char *argv[]) {
+                BenchmarkGrowth(ArgOr(argc, argv, 2, 1024));
+            }},
+            {"growth-policy", [](int argc, char *argv[]) {
+                BenchmarkGrowthPolicies(ArgOr(argc, argv, 2, 1'000'000), ArgOr(argc, argv, 3, 6),
+                                        ArgOr(argc, argv, 4, 100'000'000));
+            }},
+            {"parallel", [](int argc, char *argv[]) {
+                BenchmarkParallel(ArgOr(argc, argv, 2, 8),
+                                  ArgOr(argc, argv, 3, std::max(4u, std::thread::hardware_concurrency())));
+            }},
+            {"simd", [](int argc, char *argv[]) {
+                BenchmarkSimd(ArgOr(argc, argv, 2, 256), ArgOr(argc, argv, 3, 2000));
+            }},
+            {"soa", [](int argc, char *argv[]) {
+                BenchmarkSoA(ArgOr(argc, argv, 2, 16), ArgOr(argc, argv, 3, 10));
+            }},
+            {"zeroed", [](int argc, char *argv[]) {
+                BenchmarkZeroed(ArgOr(argc, argv, 2, 1024), ArgOr(argc, argv, 3, 1 << 16));
+            }},
+    };
+    if (argc > 1) {
+        const auto it = benchmarks.find(argv[1]);
+        if (it == benchmarks.end()) {
+            std::cerr << "unknown benchmark: " << argv[1] << std::endl;
+            return 1;
+        }
+        it->second(argc, argv);
+        return 0;
+    }
+    for (const auto &[name, run]: benchmarks) {
+        run(argc, argv);
+    }
+}
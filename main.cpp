@@ -2,6 +2,21 @@
 #include "advanced-vector/test.h"
 #include "advanced-vector/test7.h"
 #include "advanced-vector/test9.h"
+#include "advanced-vector/test_allocator.h"
+#include "advanced-vector/test_bit_vector.h"
+#include "advanced-vector/test_concurrent_vector.h"
+#include "advanced-vector/test_eytzinger_index.h"
+#include "advanced-vector/test_flat_map.h"
+#include "advanced-vector/test_gap_buffer.h"
+#include "advanced-vector/test_growth.h"
+#include "advanced-vector/test_modifiers.h"
+#include "advanced-vector/test_parallel.h"
+#include "advanced-vector/test_ring_vector.h"
+#include "advanced-vector/test_segmented_vector.h"
+#include "advanced-vector/test_small_vector.h"
+#include "advanced-vector/test_soa_vector.h"
+#include "advanced-vector/test_static_vector.h"
+#include "advanced-vector/test_vector_simd.h"
 
 namespace {
 
@@ -118,6 +133,51 @@ int main() {
         Test12_4();
         Test12_5();
         Test12_6();
+        //allocator-aware Vector
+        TestAllocator_1();
+        TestAllocator_2();
+        TestAllocator_3();
+        TestAllocator_4();
+        TestAllocator_5();
+        //growth and relocation
+        TestRelocation_1();
+        TestGrowthPolicy_1();
+        TestShrink_1();
+        //modifiers
+        TestOverwrite_1();
+        TestRangeInsert_1();
+        TestRangeErase_1();
+        TestUnorderedErase_1();
+        TestEmplaceInPlace_1();
+        TestTrivialCopy_1();
+        //parallel mode
+        TestParallel_1();
+        //concurrent append
+        TestConcurrentVector_1();
+        TestConcurrentVector_2();
+        //inline storage containers
+        TestSmallVector_1();
+        TestSmallVector_2();
+        TestStaticVector_1();
+        //specialized containers
+        TestSegmentedVector_1();
+        TestSoAVector_1();
+        TestSoAVector_2();
+        TestBitVector_1();
+        TestBitVector_2();
+        TestRingVector_1();
+        TestRingVector_2();
+        TestGapBuffer_1();
+        TestGapBuffer_2();
+        //sorted associative containers
+        TestFlatSet_1();
+        TestFlatMap_1();
+        TestEytzingerIndex_1();
+        TestEytzingerIndex_2();
+        //SIMD kernels
+        TestVectorSimd_1();
+        TestVectorSimd_2();
+        TestVectorSimd_3();
         Benchmark();
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;